@@ -39,7 +39,8 @@
 
 namespace Puzzles {
 
-// TODO: Properly test non-infinite sequences
+// Sequences are usually infinite, but the ones that do run out just return, and then their iterators compare equal to
+// end()
 template <typename T>
 struct LazySequence {
   struct promise_type {
@@ -48,6 +49,7 @@ struct LazySequence {
     constexpr auto initial_suspend() noexcept { return std::suspend_always(); }
     constexpr auto final_suspend() noexcept { return std::suspend_always(); }
     constexpr auto get_return_object() noexcept { return LazySequence(*this); }
+    constexpr void return_void() noexcept {}
     constexpr auto unhandled_exception() noexcept { std::exit(1); }
     constexpr auto yield_value(const T value) noexcept {
       lastYieldedValue = value;
@@ -66,33 +68,38 @@ struct LazySequence {
 
     explicit constexpr iterator(const std::coroutine_handle<promise_type> *handle) : handle(handle) {}
 
-    constexpr bool operator!=(const iterator &o) const { return handle != o.handle; }
+    // Telling whether there's a next value means running the coroutine until it yields one, or returns
+    constexpr bool operator!=(const iterator &o) const {
+      if (atEnd() || o.atEnd()) return atEnd() != o.atEnd();
+      return handle != o.handle;
+    }
 
     constexpr T operator*() {
-      ensure_m(handle != nullptr, "Tried to dereference the end() of a LazySequence");
-
-      if (value == nullptr) {
-        ensure(!handle->done());
-        handle->resume();
-        value = &(handle->promise().lastYieldedValue);
-      }
+      [[maybe_unused]] auto ended = atEnd();
+      ensure_m(!ended, "Tried to dereference the end() of a LazySequence");
       return *value;
     }
 
     constexpr iterator *operator++() {
-      if (value == nullptr) {
-        ensure(!handle->done());
-        // Let's skip the current value
-        handle->resume();
-      } else {
-        value = nullptr;
-      }
+      // Let's skip the current value, even if nobody asked for it yet
+      [[maybe_unused]] auto ended = atEnd();
+      ensure_m(!ended, "Tried to go past the end() of a LazySequence");
+      value = nullptr;
       return this;
     }
 
   private:
     const std::coroutine_handle<promise_type> *handle;
-    T *value = nullptr;
+    mutable T *value = nullptr;
+
+    constexpr bool atEnd() const {
+      if (handle == nullptr) return true;
+      if (value == nullptr && !handle->done()) {
+        handle->resume();
+        if (!handle->done()) value = &(handle->promise().lastYieldedValue);
+      }
+      return value == nullptr;
+    }
   };
 
   std::coroutine_handle<promise_type> handle;
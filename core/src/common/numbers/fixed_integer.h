@@ -0,0 +1,563 @@
+/*
+ * Copyright (c) 2026 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "common/assertions.h"
+
+#include <algorithm> // std::copy, std::copy_n, std::reverse
+#include <array>     // std::array
+#include <bit>       // std::bit_width, std::countl_zero, std::countr_zero
+#include <cstddef>   // size_t
+#include <cstdint>   // int64_t, uint64_t, intmax_t
+#include <numeric>   // std::gcd
+#include <optional>  // std::optional
+#include <string>    // std::string
+#include <tuple>     // std::tie
+#include <utility>   // std::make_pair, std::pair, std::swap
+
+namespace pzl {
+
+// A stack-only, fixed-width counterpart to Integer, for values we know never need more than Bits bits. It has the same
+// interface and semantics, but every operation is constexpr, and overflowing is an error instead of a reallocation
+template <size_t Bits>
+struct FixedInteger {
+  static_assert(Bits > 0 && Bits % 64 == 0, "FixedInteger works on whole 64-bit words");
+
+  using value_t = uint64_t;
+  static constexpr size_t wordCount = Bits / 64;
+  using words_t = std::array<value_t, wordCount>;
+
+  constexpr explicit FixedInteger(intmax_t value) : _positive(value >= 0) {
+    words[0] = value >= 0 ? static_cast<value_t>(value) : ~static_cast<value_t>(value) + 1;
+  }
+
+  constexpr explicit FixedInteger(const std::string &value) {
+    ensure(!value.empty());
+
+    auto negative = value[0] == '-';
+    ensure(value.size() > (negative ? 1u : 0u));
+
+    for (size_t i = negative ? 1 : 0; i < value.size(); ++i) {
+      ensure(value[i] >= '0' && value[i] <= '9');
+
+      auto overflow = multiplyAddWord(&words, 10, static_cast<value_t>(value[i] - '0'));
+      ensure_m(overflow == 0, "FixedInteger<" << Bits << "> can't hold " << value);
+      UNUSED(overflow);
+    }
+
+    _positive = !negative || isZero(words);
+  }
+
+  [[nodiscard]] constexpr FixedInteger absolute() const { return FixedInteger{words, true}; }
+  [[nodiscard]] constexpr bool positive() const { return _positive; }
+  // How many bits the absolute value needs, zero needs none
+  [[nodiscard]] constexpr size_t bitLength() const {
+    auto size = significantWords(words);
+    return size == 0 ? 0 : (size - 1) * 64 + static_cast<size_t>(std::bit_width(words[size - 1]));
+  }
+
+  [[nodiscard]] constexpr std::string toString() const {
+    if (isZero(words)) return "0";
+
+    std::string result;
+    auto remaining = words;
+    while (!isZero(remaining)) {
+      // Peeling off 19 digits at a time, the most a single word can take
+      auto chunk = divideByWord(&remaining, 10000000000000000000ull);
+      for (auto i = 0; i < 19 && (chunk > 0 || !isZero(remaining)); ++i) {
+        result += static_cast<char>('0' + chunk % 10);
+        chunk /= 10;
+      }
+    }
+    if (!_positive) result += '-';
+
+    std::reverse(result.begin(), result.end());
+    return result;
+  }
+
+  // These return nothing if the result doesn't fit in Bits bits, while the operators below treat it as an error
+  [[nodiscard]] constexpr std::optional<FixedInteger> checkedAdd(const FixedInteger &o) const {
+    return sum(o._positive, o);
+  }
+  [[nodiscard]] constexpr std::optional<FixedInteger> checkedSubtract(const FixedInteger &o) const {
+    return sum(!o._positive, o);
+  }
+  [[nodiscard]] constexpr std::optional<FixedInteger> checkedMultiply(const FixedInteger &o) const {
+    words_t product{};
+    for (size_t i = 0; i < wordCount; ++i) {
+      if (words[i] == 0) continue;
+
+      value_t carryOver = 0;
+      for (size_t j = 0; j < wordCount; ++j) {
+        auto current = static_cast<unsigned __int128>(words[i]) * o.words[j] + carryOver;
+        if (i + j < wordCount) {
+          current += product[i + j];
+          product[i + j] = static_cast<value_t>(current);
+        } else if (static_cast<value_t>(current) != 0) {
+          return std::nullopt;
+        }
+        carryOver = static_cast<value_t>(current >> 64);
+      }
+      if (carryOver != 0) return std::nullopt;
+    }
+    return FixedInteger{product, _positive == o._positive};
+  }
+
+  [[nodiscard]] constexpr FixedInteger operator+(const FixedInteger &o) const { return unwrap(checkedAdd(o)); }
+  [[nodiscard]] constexpr FixedInteger operator-(const FixedInteger &o) const { return unwrap(checkedSubtract(o)); }
+  [[nodiscard]] constexpr FixedInteger operator*(const FixedInteger &o) const { return unwrap(checkedMultiply(o)); }
+  [[nodiscard]] constexpr FixedInteger operator/(const FixedInteger &o) const { return divmod(o).first; }
+  [[nodiscard]] constexpr FixedInteger operator%(const FixedInteger &o) const { return divmod(o).second; }
+
+  // Truncated division, returns both the quotient and the remainder, which always has the same sign as *this
+  [[nodiscard]] constexpr std::pair<FixedInteger, FixedInteger> divmod(const FixedInteger &o) const {
+    ensure(!isZero(o.words));
+
+    words_t quotient{};
+    auto remainder = words;
+    auto divisorSize = significantWords(o.words);
+    if (divisorSize == 1) {
+      quotient = words;
+      remainder = {};
+      remainder[0] = divideByWord(&quotient, o.words[0]);
+    } else if (compareWords(words, o.words) >= 0) {
+      divideWords(&remainder, o.words, divisorSize, &quotient);
+    }
+
+    return {FixedInteger{quotient, _positive == o._positive}, FixedInteger{remainder, _positive}};
+  }
+
+  [[nodiscard]] constexpr FixedInteger operator+(intmax_t o) const { return *this + FixedInteger{o}; }
+  [[nodiscard]] constexpr FixedInteger operator-(intmax_t o) const { return *this - FixedInteger{o}; }
+  [[nodiscard]] constexpr FixedInteger operator*(intmax_t o) const { return *this * FixedInteger{o}; }
+
+  [[nodiscard]] constexpr std::optional<FixedInteger> checkedShiftLeft(size_t bits) const {
+    if (isZero(words)) return *this;
+    if (bitLength() + bits > Bits) return std::nullopt;
+
+    words_t result{};
+    const auto offset = bits / 64;
+    const auto shift = bits % 64;
+    for (auto i = wordCount; i > offset; --i) {
+      auto high = words[i - 1 - offset];
+      auto low = i - 1 > offset ? words[i - 2 - offset] : 0;
+      result[i - 1] = shift == 0 ? high : (high << shift) | (low >> (64 - shift));
+    }
+    return FixedInteger{result, _positive};
+  }
+
+  // Shifting right truncates towards zero, like dividing by a power of two
+  [[nodiscard]] constexpr FixedInteger operator<<(size_t bits) const { return unwrap(checkedShiftLeft(bits)); }
+  [[nodiscard]] constexpr FixedInteger operator>>(size_t bits) const {
+    words_t result{};
+    const auto offset = bits / 64;
+    const auto shift = bits % 64;
+    for (size_t i = 0; i + offset < wordCount; ++i) {
+      auto low = words[i + offset];
+      auto high = i + offset + 1 < wordCount ? words[i + offset + 1] : 0;
+      result[i] = shift == 0 ? low : (low >> shift) | (high << (64 - shift));
+    }
+    return FixedInteger{result, _positive};
+  }
+
+  // Bitwise operations and testBit treat negative values as if they were in an infinitely wide two's complement
+  [[nodiscard]] constexpr FixedInteger operator&(const FixedInteger &o) const {
+    return bitwise(o, [](value_t left, value_t right) { return left & right; });
+  }
+  [[nodiscard]] constexpr FixedInteger operator|(const FixedInteger &o) const {
+    return bitwise(o, [](value_t left, value_t right) { return left | right; });
+  }
+  [[nodiscard]] constexpr FixedInteger operator^(const FixedInteger &o) const {
+    return bitwise(o, [](value_t left, value_t right) { return left ^ right; });
+  }
+  [[nodiscard]] constexpr bool testBit(size_t bit) const {
+    const auto magnitudeBit = bit < Bits && ((words[bit / 64] >> (bit % 64)) & 1) != 0;
+    if (_positive) return magnitudeBit;
+
+    // In ~(m - 1), the bits below m's lowest set one stay zero, that one stays set, and every other one gets flipped
+    size_t lowestSetBit = 0;
+    for (auto word : words) {
+      if (word != 0) {
+        lowestSetBit += static_cast<size_t>(std::countr_zero(word));
+        break;
+      }
+      lowestSetBit += 64;
+    }
+    return bit <= lowestSetBit ? bit == lowestSetBit : !magnitudeBit;
+  }
+
+  [[nodiscard]] constexpr FixedInteger power(const FixedInteger &exponent) const {
+    ensure(exponent._positive);
+
+    FixedInteger result{1};
+    for (auto bit = exponent.bitLength(); bit > 0; --bit) {
+      result *= result;
+      if (exponent.testBit(bit - 1)) result *= *this;
+    }
+    return result;
+  }
+
+  // (*this ^ exponent) % modulus, always in the [0, |modulus|) range
+  [[nodiscard]] constexpr FixedInteger powMod(const FixedInteger &exponent, const FixedInteger &modulus) const {
+    ensure(exponent._positive);
+    ensure(!isZero(modulus.words));
+
+    // The products need twice as many bits before they're reduced
+    using Wide = FixedInteger<Bits * 2>;
+    auto widen = [](const FixedInteger &value) {
+      typename Wide::words_t wide{};
+      std::copy(value.words.begin(), value.words.end(), wide.begin());
+      return Wide{wide, true}; // Only the magnitude
+    };
+    auto wideModulus = widen(modulus);
+
+    auto reduced = *this % modulus.absolute();
+    auto base = reduced._positive ? widen(reduced) : wideModulus - widen(reduced);
+    auto result = Wide{1} % wideModulus;
+    for (auto bit = exponent.bitLength(); bit > 0; --bit) {
+      result = result * result % wideModulus;
+      if (exponent.testBit(bit - 1)) result = result * base % wideModulus;
+    }
+
+    words_t narrow{};
+    std::copy_n(result.words.begin(), wordCount, narrow.begin());
+    return FixedInteger{narrow, true};
+  }
+
+  [[nodiscard]] constexpr bool operator==(const FixedInteger &o) const = default;
+  [[nodiscard]] constexpr bool operator!=(const FixedInteger &o) const = default;
+
+  [[nodiscard]] constexpr bool operator<(const FixedInteger &o) const {
+    if (_positive != o._positive) return o._positive;
+
+    auto comparison = compareWords(words, o.words);
+    return _positive ? comparison < 0 : comparison > 0;
+  }
+  [[nodiscard]] constexpr bool operator<=(const FixedInteger &o) const { return !(o < *this); }
+  [[nodiscard]] constexpr bool operator>(const FixedInteger &o) const { return o < *this; }
+  [[nodiscard]] constexpr bool operator>=(const FixedInteger &o) const { return !(*this < o); }
+
+  [[nodiscard]] constexpr bool operator==(intmax_t o) const { return *this == FixedInteger{o}; }
+  [[nodiscard]] constexpr bool operator!=(intmax_t o) const { return *this != FixedInteger{o}; }
+  [[nodiscard]] constexpr bool operator<(intmax_t o) const { return *this < FixedInteger{o}; }
+  [[nodiscard]] constexpr bool operator<=(intmax_t o) const { return *this <= FixedInteger{o}; }
+  [[nodiscard]] constexpr bool operator>(intmax_t o) const { return *this > FixedInteger{o}; }
+  [[nodiscard]] constexpr bool operator>=(intmax_t o) const { return *this >= FixedInteger{o}; }
+
+  constexpr FixedInteger &operator++() { return *this += 1; }
+  constexpr FixedInteger &operator+=(const FixedInteger &o) { return *this = *this + o; }
+  constexpr FixedInteger &operator-=(const FixedInteger &o) { return *this = *this - o; }
+  constexpr FixedInteger &operator*=(const FixedInteger &o) { return *this = *this * o; }
+  constexpr FixedInteger &operator/=(const FixedInteger &o) { return *this = *this / o; }
+  constexpr FixedInteger &operator%=(const FixedInteger &o) { return *this = *this % o; }
+  constexpr FixedInteger &operator+=(intmax_t o) { return *this = *this + o; }
+  constexpr FixedInteger &operator-=(intmax_t o) { return *this = *this - o; }
+  constexpr FixedInteger &operator*=(intmax_t o) { return *this = *this * o; }
+  constexpr FixedInteger &operator<<=(size_t bits) { return *this = *this << bits; }
+  constexpr FixedInteger &operator>>=(size_t bits) { return *this = *this >> bits; }
+  constexpr FixedInteger &operator&=(const FixedInteger &o) { return *this = *this & o; }
+  constexpr FixedInteger &operator|=(const FixedInteger &o) { return *this = *this | o; }
+  constexpr FixedInteger &operator^=(const FixedInteger &o) { return *this = *this ^ o; }
+
+private:
+  constexpr FixedInteger(const words_t &words, bool positive) : words(words), _positive(positive || isZero(words)) {}
+
+  template <size_t>
+  friend struct FixedInteger;
+
+  template <size_t B>
+  friend constexpr FixedInteger<B> greatestCommonDivisor(FixedInteger<B>, FixedInteger<B>);
+
+  static constexpr FixedInteger unwrap(const std::optional<FixedInteger> &result) {
+    ensure_m(result.has_value(), "FixedInteger<" << Bits << "> overflowed");
+    return result.value_or(FixedInteger{0});
+  }
+
+  template <typename Operation>
+  [[nodiscard]] constexpr FixedInteger bitwise(const FixedInteger &o, const Operation &operation) const {
+    // One more word leaves room for the sign bit, -m being ~(m - 1)
+    using twos_complement_t = std::array<value_t, wordCount + 1>;
+    auto twosComplement = [](const FixedInteger &value) {
+      twos_complement_t result{};
+      std::copy(value.words.begin(), value.words.end(), result.begin());
+      if (!value._positive) {
+        for (auto &word : result) {
+          if (word-- != 0) break;
+        }
+        for (auto &word : result) {
+          word = ~word;
+        }
+      }
+      return result;
+    };
+
+    auto result = twosComplement(*this);
+    const auto other = twosComplement(o);
+    for (size_t i = 0; i <= wordCount; ++i) {
+      result[i] = operation(result[i], other[i]);
+    }
+
+    auto positive = (result[wordCount] >> 63) == 0;
+    if (!positive) {
+      for (auto &word : result) {
+        word = ~word;
+      }
+      for (auto &word : result) {
+        if (++word != 0) break;
+      }
+    }
+    ensure_m(result[wordCount] == 0, "FixedInteger<" << Bits << "> overflowed");
+
+    words_t magnitude{};
+    std::copy_n(result.begin(), wordCount, magnitude.begin());
+    return FixedInteger{magnitude, positive};
+  }
+
+  // Adds o, or subtracts it if positive doesn't match its own sign
+  [[nodiscard]] constexpr std::optional<FixedInteger> sum(bool positive, const FixedInteger &o) const {
+    if (_positive == positive) {
+      words_t result{};
+      value_t carryOver = 0;
+      for (size_t i = 0; i < wordCount; ++i) {
+        auto current = static_cast<unsigned __int128>(words[i]) + o.words[i] + carryOver;
+        result[i] = static_cast<value_t>(current);
+        carryOver = static_cast<value_t>(current >> 64);
+      }
+      if (carryOver != 0) return std::nullopt;
+      return FixedInteger{result, _positive};
+    }
+
+    auto comparison = compareWords(words, o.words);
+    const auto &bigger = comparison >= 0 ? words : o.words;
+    const auto &smaller = comparison >= 0 ? o.words : words;
+    auto result = bigger;
+    subtractWords(&result, smaller, 0);
+    return FixedInteger{result, comparison >= 0 ? _positive : positive};
+  }
+
+  static constexpr bool isZero(const words_t &words) { return significantWords(words) == 0; }
+
+  static constexpr size_t significantWords(const words_t &words) {
+    auto size = wordCount;
+    while (size > 0 && words[size - 1] == 0) {
+      --size;
+    }
+    return size;
+  }
+
+  static constexpr int compareWords(const words_t &left, const words_t &right) {
+    for (auto i = wordCount; i > 0; --i) {
+      if (left[i - 1] != right[i - 1]) return left[i - 1] < right[i - 1] ? -1 : 1;
+    }
+    return 0;
+  }
+
+  // target -= source << (offset * 64), where target has to be the bigger one
+  static constexpr void subtractWords(words_t *target, const words_t &source, size_t offset) {
+    value_t borrow = 0;
+    for (size_t i = 0; i + offset < wordCount; ++i) {
+      auto &word = (*target)[i + offset];
+      auto subtrahend = static_cast<unsigned __int128>(source[i]) + borrow;
+      borrow = subtrahend > word ? 1 : 0;
+      word = static_cast<value_t>(word - subtrahend);
+    }
+    ensure(borrow == 0);
+  }
+
+  // words = words * multiplier + addend, returning whatever didn't fit
+  static constexpr value_t multiplyAddWord(words_t *words, value_t multiplier, value_t addend) {
+    auto carryOver = addend;
+    for (auto &word : *words) {
+      auto current = static_cast<unsigned __int128>(word) * multiplier + carryOver;
+      word = static_cast<value_t>(current);
+      carryOver = static_cast<value_t>(current >> 64);
+    }
+    return carryOver;
+  }
+
+  // Divides words by divisor in place, returning the remainder
+  static constexpr value_t divideByWord(words_t *words, value_t divisor) {
+    unsigned __int128 remainder = 0;
+    for (auto i = wordCount; i > 0; --i) {
+      auto current = (remainder << 64) | (*words)[i - 1];
+      (*words)[i - 1] = static_cast<value_t>(current / divisor);
+      remainder = current % divisor;
+    }
+    return static_cast<value_t>(remainder);
+  }
+
+  // This is Knuth's algorithm D, in base 2^64, for divisors of at least two words. The dividend is replaced by the
+  // remainder
+  static constexpr void divideWords(words_t *dividend, const words_t &divisor, size_t divisorSize, words_t *quotient) {
+    const auto n = divisorSize;
+    const auto m = significantWords(*dividend) - n;
+
+    // Normalizing, so the divisor's top bit is set, keeps every estimated quotient digit at most two above the real one
+    const auto shift = std::countl_zero(divisor[n - 1]);
+    auto shifted = [shift](const value_t *words, size_t size, value_t *target) {
+      value_t carryOver = 0;
+      for (size_t i = 0; i < size; ++i) {
+        target[i] = shift == 0 ? words[i] : (words[i] << shift) | carryOver;
+        carryOver = shift == 0 ? 0 : words[i] >> (64 - shift);
+      }
+      return carryOver;
+    };
+
+    std::array<value_t, wordCount> v{};
+    shifted(divisor.data(), n, v.data());
+    std::array<value_t, wordCount + 1> u{};
+    u[m + n] = shifted(dividend->data(), m + n, u.data());
+
+    constexpr auto base = static_cast<unsigned __int128>(1) << 64;
+    for (auto j = m + 1; j > 0; --j) {
+      const auto k = j - 1;
+
+      auto numerator = (static_cast<unsigned __int128>(u[k + n]) << 64) | u[k + n - 1];
+      auto estimate = numerator / v[n - 1];
+      auto estimateRemainder = numerator % v[n - 1];
+      while (estimate >= base || estimate * v[n - 2] > ((estimateRemainder << 64) | u[k + n - 2])) {
+        --estimate;
+        estimateRemainder += v[n - 1];
+        if (estimateRemainder >= base) break;
+      }
+
+      __int128 borrow = 0;
+      __int128 current = 0;
+      for (size_t i = 0; i < n; ++i) {
+        auto product = estimate * v[i];
+        current = static_cast<__int128>(u[i + k]) - borrow - static_cast<__int128>(static_cast<value_t>(product));
+        u[i + k] = static_cast<value_t>(current);
+        borrow = static_cast<__int128>(product >> 64) - (current >> 64);
+      }
+      current = static_cast<__int128>(u[k + n]) - borrow;
+      u[k + n] = static_cast<value_t>(current);
+
+      if (current < 0) {
+        // The estimate was one too big, so we add a divisor back
+        --estimate;
+        unsigned __int128 carryOver = 0;
+        for (size_t i = 0; i < n; ++i) {
+          carryOver += static_cast<unsigned __int128>(u[i + k]) + v[i];
+          u[i + k] = static_cast<value_t>(carryOver);
+          carryOver >>= 64;
+        }
+        u[k + n] += static_cast<value_t>(carryOver);
+      }
+      (*quotient)[k] = static_cast<value_t>(estimate);
+    }
+
+    *dividend = {};
+    for (size_t i = 0; i < n; ++i) {
+      (*dividend)[i] = shift == 0 ? u[i] : (u[i] >> shift) | (u[i + 1] << (64 - shift));
+    }
+  }
+
+  words_t words{}; // Little-endian magnitude
+  bool _positive = true;
+};
+
+// Always positive, unless both are zero. This is Lehmer's algorithm, like Integer's, but on 64-bit words
+template <size_t Bits>
+constexpr FixedInteger<Bits> greatestCommonDivisor(FixedInteger<Bits> left, FixedInteger<Bits> right) {
+  using Fixed = FixedInteger<Bits>;
+  using words_t = typename Fixed::words_t;
+
+  auto bigger = left.words, smaller = right.words;
+  if (Fixed::compareWords(bigger, smaller) < 0) std::swap(bigger, smaller);
+
+  auto bitsAt = [](const words_t &words, size_t offset) {
+    auto index = offset / 64;
+    auto window = static_cast<unsigned __int128>(words[index]);
+    if (index + 1 < Fixed::wordCount) window |= static_cast<unsigned __int128>(words[index + 1]) << 64;
+    return static_cast<uint64_t>(window >> (offset % 64));
+  };
+
+  // left * leftFactor + right * rightFactor, which has to be non-negative
+  auto linearCombination = [](const words_t &left, int64_t leftFactor, const words_t &right, int64_t rightFactor) {
+    words_t result{};
+    __int128 carryOver = 0;
+    for (size_t i = 0; i < Fixed::wordCount; ++i) {
+      __int128 current = carryOver + static_cast<__int128>(left[i]) * leftFactor;
+      current += static_cast<__int128>(right[i]) * rightFactor;
+
+      result[i] = static_cast<uint64_t>(current);
+      carryOver = current >> 64; // Arithmetic shift, so negative carries work as borrows
+    }
+    ensure(carryOver == 0);
+    return result;
+  };
+
+  constexpr size_t leadingBits = 62;
+  while (Fixed::significantWords(smaller) > 1) {
+    const auto offset = Fixed{bigger, true}.bitLength() - leadingBits;
+    auto x = static_cast<int64_t>(bitsAt(bigger, offset));
+    auto y = static_cast<int64_t>(bitsAt(smaller, offset));
+
+    int64_t a = 1, b = 0, c = 0, d = 1;
+    while (y + c != 0 && y + d != 0) {
+      auto quotient = (x + a) / (y + c);
+      if (quotient != (x + b) / (y + d)) break;
+
+      std::tie(a, c) = std::make_pair(c, a - quotient * c);
+      std::tie(b, d) = std::make_pair(d, b - quotient * d);
+      std::tie(x, y) = std::make_pair(y, x - quotient * y);
+    }
+
+    if (b == 0) {
+      // The leading bits weren't enough to agree on a single quotient, so we need a whole division step
+      words_t quotient{};
+      Fixed::divideWords(&bigger, smaller, Fixed::significantWords(smaller), &quotient);
+      std::swap(bigger, smaller);
+    } else {
+      auto nextSmaller = linearCombination(bigger, c, smaller, d);
+      bigger = linearCombination(bigger, a, smaller, b);
+      smaller = nextSmaller;
+    }
+  }
+
+  // Now the smaller one fits in a machine word, and after one more step so does the bigger one
+  if (Fixed::isZero(smaller)) return Fixed{bigger, true};
+
+  words_t gcd{};
+  gcd[0] = std::gcd(smaller[0], Fixed::divideByWord(&bigger, smaller[0]));
+  return Fixed{gcd, true};
+}
+}
+
+namespace std { // NOLINT(cert-dcl58-cpp)
+
+template <size_t Bits>
+inline pzl::FixedInteger<Bits> abs(const pzl::FixedInteger<Bits> &integer) {
+  return integer.absolute();
+}
+
+template <size_t Bits>
+inline pzl::FixedInteger<Bits> pow(const pzl::FixedInteger<Bits> &base, const pzl::FixedInteger<Bits> &exponent) {
+  return base.power(exponent);
+}
+
+template <size_t Bits>
+inline string to_string(const pzl::FixedInteger<Bits> &integer) {
+  return integer.toString();
+}
+}
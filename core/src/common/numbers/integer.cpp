@@ -22,83 +22,607 @@
 
 #include "integer.h"
 
-#include "common/assertions.h" // ensure
-#include "common/strings.h"    // Puzzles::padLeading
-#include "compat/compare.h"    // compat::strong_ordering, compat::compare
-
-#include <cmath> // std::pow
+#include "common/assertions.h"       // ensure
+#include "common/numbers/integers.h" // greatestCommonDivisor, iroot, isPerfectSquare, isProbablePrime
+#include "compat/compare.h"           // compat::strong_ordering, compat::compare
+
+#include <algorithm> // std::copy, std::copy_n, std::fill, std::max, std::min
+#include <array>     // std::array
+#include <bit>       // std::bit_width, std::countl_zero, std::countr_zero
+#include <cmath>     // std::pow
+#include <numeric>   // std::gcd
+#include <optional>  // std::optional
+#include <random>    // std::mt19937_64
+#include <tuple>     // std::tie
+#include <vector>    // std::vector
 
 using pzl::Integer;
 
-constexpr Integer::value_t SLICE_MAX = 999999999;
-constexpr Integer::value_t SLICE_SIZE = SLICE_MAX + 1;
+constexpr auto SLICE_BITS = 32;
+constexpr Integer::value_t SLICE_MAX = UINT32_MAX;
+constexpr uint64_t SLICE_SIZE = uint64_t{1} << SLICE_BITS;
+
+// The biggest power of ten that fits in a single slice, used when converting from and to decimal
+constexpr auto DECIMAL_CHUNK_DIGITS = 9;
+constexpr Integer::value_t DECIMAL_CHUNK_SIZE = 1000000000;
+// Below this many slices, converting from and to decimal one chunk at a time beats divide and conquer
+constexpr size_t DECIMAL_BASE_CASE_SLICES = 128;
+
+// "00", "01", ..., "99", so we can write two digits at a time
+constexpr auto DIGIT_PAIRS = [] {
+  std::array<char, 200> pairs{};
+  for (auto i = 0; i < 100; ++i) {
+    pairs[static_cast<size_t>(i * 2)] = static_cast<char>('0' + i / 10);
+    pairs[static_cast<size_t>(i * 2 + 1)] = static_cast<char>('0' + i % 10);
+  }
+  return pairs;
+}();
 
-template <typename value_t, typename iterator>
-inline value_t valueAndAdvance(iterator *it) {
-  value_t value = **it;
-  std::advance(*it, 1);
-  return value;
+inline uintmax_t magnitudeOf(intmax_t value) {
+  // Negating as unsigned so even the minimum intmax_t works
+  return value < 0 ? 0 - static_cast<uintmax_t>(value) : static_cast<uintmax_t>(value);
 }
 
-Integer::Integer(const std::string &value) : _positive(value.empty() || value[0] != '-') {
-  if (value.empty() || value == "0") {
-    ensure(_positive); // Can't have negative zero
-    return;
+// Adds [source, source + sourceSize) into [target, target + targetSize), returning the carry over that didn't fit
+inline Integer::value_t addSlicesWithCarry(Integer::value_t *target, size_t targetSize, const Integer::value_t *source,
+                                           size_t sourceSize) {
+  ensure(sourceSize <= targetSize);
+
+  uint64_t carryOver = 0;
+  size_t i = 0;
+  for (; i < sourceSize; ++i) {
+    uint64_t sum = static_cast<uint64_t>(target[i]) + source[i] + carryOver;
+    target[i] = static_cast<Integer::value_t>(sum);
+    carryOver = sum >> SLICE_BITS;
   }
 
-  std::string_view offset{value};
-  if (offset[0] == '-') {
-    offset = offset.substr(1);
+  for (; carryOver && i < targetSize; ++i) {
+    carryOver = ++target[i] == 0 ? 1 : 0;
+  }
+
+  return static_cast<Integer::value_t>(carryOver);
+}
+
+// Adds [source, source + sourceSize) into [target, target + targetSize), the sum has to fit into targetSize slices
+inline void addSlicesInto(Integer::value_t *target, size_t targetSize, const Integer::value_t *source,
+                          size_t sourceSize) {
+  auto carryOver = addSlicesWithCarry(target, targetSize, source, sourceSize);
+  ensure(carryOver == 0);
+  UNUSED(carryOver);
+}
+
+// Subtracts [source, source + sourceSize) from [target, target + targetSize), target has to be the biggest one
+inline void subtractSlicesFrom(Integer::value_t *target, size_t targetSize, const Integer::value_t *source,
+                               size_t sourceSize) {
+  ensure(sourceSize <= targetSize);
+
+  uint64_t borrow = 0;
+  size_t i = 0;
+  for (; i < sourceSize; ++i) {
+    uint64_t difference = static_cast<uint64_t>(target[i]) - source[i] - borrow;
+    target[i] = static_cast<Integer::value_t>(difference);
+    borrow = (difference >> SLICE_BITS) & 1; // Set when it wrapped around
+  }
+
+  for (; borrow; ++i) {
+    ensure(i < targetSize);
+    borrow = target[i]-- == 0 ? 1 : 0;
+  }
+}
+
+inline size_t significantSlices(const Integer::value_t *slices, size_t size) {
+  while (size > 0 && slices[size - 1] == 0) {
+    --size;
+  }
+  return size;
+}
+
+inline std::vector<Integer::value_t> sumOfHalves(const Integer::value_t *low, size_t lowSize,
+                                                 const Integer::value_t *high, size_t highSize) {
+  std::vector<Integer::value_t> sum(std::max(lowSize, highSize) + 1);
+  std::copy(low, low + lowSize, sum.begin());
+  addSlicesInto(sum.data(), sum.size(), high, highSize);
+  sum.resize(significantSlices(sum.data(), sum.size()));
+  return sum;
+}
+
+// result has to hold leftSize + rightSize slices, all of them zeroed
+void multiplySlicesSchoolbook(const Integer::value_t *left, size_t leftSize, const Integer::value_t *right,
+                              size_t rightSize, Integer::value_t *result) {
+  for (size_t i = 0; i < leftSize; ++i) {
+    uint64_t multiplier = left[i];
+    if (multiplier == 0) continue;
+
+    uint64_t carryOver = 0;
+    for (size_t j = 0; j < rightSize; ++j) {
+      // Can't overflow: SLICE_MAX * SLICE_MAX + SLICE_MAX + SLICE_MAX is exactly 2^64 - 1
+      uint64_t current = result[i + j] + multiplier * right[j] + carryOver;
+      result[i + j] = static_cast<Integer::value_t>(current);
+      carryOver = current >> SLICE_BITS;
+    }
+    result[i + rightSize] = static_cast<Integer::value_t>(carryOver);
+  }
+}
+
+void multiplySlices(const Integer::value_t *left, size_t leftSize, const Integer::value_t *right, size_t rightSize,
+                    Integer::value_t *result);
+
+// This is the Karatsuba algorithm: with B = SLICE_SIZE^half, left = l1*B + l0 and right = r1*B + r0
+// left * right = (l1*r1)*B^2 + ((l0+l1)*(r0+r1) - l0*r0 - l1*r1)*B + l0*r0
+void multiplySlicesKaratsuba(const Integer::value_t *left, size_t leftSize, const Integer::value_t *right,
+                             size_t rightSize, Integer::value_t *result) {
+  const auto half = leftSize / 2; // Since leftSize < rightSize * 2, rightSize > half as well
+  const auto resultSize = leftSize + rightSize;
+
+  auto low = result;
+  auto high = result + half * 2;
+  multiplySlices(left, half, right, half, low);
+  multiplySlices(left + half, leftSize - half, right + half, rightSize - half, high);
+
+  auto leftSum = sumOfHalves(left, half, left + half, leftSize - half);
+  auto rightSum = sumOfHalves(right, half, right + half, rightSize - half);
+
+  std::vector<Integer::value_t> middle(leftSum.size() + rightSum.size());
+  multiplySlices(leftSum.data(), leftSum.size(), rightSum.data(), rightSum.size(), middle.data());
+
+  subtractSlicesFrom(middle.data(), middle.size(), low, significantSlices(low, half * 2));
+  subtractSlicesFrom(middle.data(), middle.size(), high, significantSlices(high, resultSize - half * 2));
+
+  addSlicesInto(result + half, resultSize - half, middle.data(), significantSlices(middle.data(), middle.size()));
+}
+
+// Toom-Cook's intermediate values can go negative, so they carry their own sign
+struct SignedSlices {
+  std::vector<Integer::value_t> magnitude; // Always trimmed, so zero is empty
+  bool negative = false;
+
+  SignedSlices(const Integer::value_t *slices, size_t size)
+      : magnitude(slices, slices + significantSlices(slices, size)) {}
+  SignedSlices(std::vector<Integer::value_t> magnitude, bool negative)
+      : magnitude(std::move(magnitude)) {
+    this->magnitude.resize(significantSlices(this->magnitude.data(), this->magnitude.size()));
+    this->negative = negative && !this->magnitude.empty();
+  }
+
+  [[nodiscard]] SignedSlices operator+(const SignedSlices &o) const {
+    const auto &[longer, shorter] = magnitude.size() >= o.magnitude.size() ? std::tie(*this, o) : std::tie(o, *this);
+
+    if (negative == o.negative) {
+      std::vector<Integer::value_t> sum(longer.magnitude.size() + 1);
+      std::copy(longer.magnitude.begin(), longer.magnitude.end(), sum.begin());
+      addSlicesInto(sum.data(), sum.size(), shorter.magnitude.data(), shorter.magnitude.size());
+      return SignedSlices{std::move(sum), negative};
+    }
+
+    auto comparison = compat::compare(longer.magnitude.size(), shorter.magnitude.size());
+    for (auto i = longer.magnitude.size(); comparison == compat::strong_ordering::equal && i > 0; --i) {
+      comparison = compat::compare(longer.magnitude[i - 1], shorter.magnitude[i - 1]);
+    }
+    const auto &bigger = comparison == compat::strong_ordering::less ? shorter : longer;
+    const auto &smaller = comparison == compat::strong_ordering::less ? longer : shorter;
+
+    auto difference = bigger.magnitude;
+    subtractSlicesFrom(difference.data(), difference.size(), smaller.magnitude.data(), smaller.magnitude.size());
+    return SignedSlices{std::move(difference), bigger.negative};
+  }
+
+  [[nodiscard]] SignedSlices operator-(const SignedSlices &o) const {
+    return *this + SignedSlices{o.magnitude, !o.negative};
+  }
+
+  [[nodiscard]] SignedSlices operator*(const SignedSlices &o) const {
+    if (magnitude.empty() || o.magnitude.empty()) return SignedSlices{std::vector<Integer::value_t>{}, false};
+
+    std::vector<Integer::value_t> product(magnitude.size() + o.magnitude.size());
+    multiplySlices(magnitude.data(), magnitude.size(), o.magnitude.data(), o.magnitude.size(), product.data());
+    return SignedSlices{std::move(product), negative != o.negative};
   }
-  ensure(offset.substr(1).find_first_not_of("0123456789") == value.npos);
 
-  auto it = offset.crbegin();
-  while (it != offset.crend()) {
-    uint_fast32_t result = 0;
-    for (auto i = 0; i < 9; ++i) {
-      if (it != offset.crend()) {
-        auto digit = valueAndAdvance<char>(&it) - '0';
-        result += digit * std::pow(10, i);
+  [[nodiscard]] SignedSlices operator*(Integer::value_t multiplier) const {
+    std::vector<Integer::value_t> product(magnitude.size() + 1);
+    uint64_t carryOver = 0;
+    for (size_t i = 0; i < magnitude.size(); ++i) {
+      uint64_t current = static_cast<uint64_t>(magnitude[i]) * multiplier + carryOver;
+      product[i] = static_cast<Integer::value_t>(current);
+      carryOver = current >> SLICE_BITS;
+    }
+    product.back() = static_cast<Integer::value_t>(carryOver);
+    return SignedSlices{std::move(product), negative};
+  }
+
+  // Only for divisions that we know have no remainder
+  [[nodiscard]] SignedSlices operator/(Integer::value_t divisor) const {
+    std::vector<Integer::value_t> quotient(magnitude.size());
+    uint64_t remainder = 0;
+    for (auto i = magnitude.size(); i > 0; --i) {
+      uint64_t current = (remainder << SLICE_BITS) | magnitude[i - 1];
+      quotient[i - 1] = static_cast<Integer::value_t>(current / divisor);
+      remainder = current % divisor;
+    }
+    ensure(remainder == 0);
+    return SignedSlices{std::move(quotient), negative};
+  }
+};
+
+// This is the Toom-3 algorithm: splitting both into thirds makes them quadratic polynomials on B = SLICE_SIZE^third,
+// whose product we interpolate from its values at 0, 1, -1, -2 and infinity, using Bodrato's sequence
+void multiplySlicesToomCook(const Integer::value_t *left, size_t leftSize, const Integer::value_t *right,
+                            size_t rightSize, Integer::value_t *result) {
+  const auto third = (leftSize + 2) / 3; // Since leftSize < rightSize * 2, rightSize > third as well
+
+  auto split = [third](const Integer::value_t *slices, size_t size) {
+    auto part = [&](size_t index) {
+      auto offset = std::min(index * third, size);
+      auto length = index == 2 ? size - offset : std::min(third, size - offset);
+      return SignedSlices{slices + offset, length};
+    };
+    return std::array<SignedSlices, 3>{part(0), part(1), part(2)};
+  };
+
+  auto evaluate = [](const std::array<SignedSlices, 3> &parts) {
+    const auto &[a0, a1, a2] = parts;
+    auto even = a0 + a2;
+    auto minusOne = even - a1;
+    auto minusTwo = (minusOne + a2) * 2 - a0;
+    return std::array<SignedSlices, 3>{even + a1, minusOne, minusTwo};
+  };
+
+  const auto leftParts = split(left, leftSize);
+  const auto rightParts = split(right, rightSize);
+  const auto leftValues = evaluate(leftParts);
+  const auto rightValues = evaluate(rightParts);
+
+  const auto atZero = leftParts[0] * rightParts[0];
+  const auto atOne = leftValues[0] * rightValues[0];
+  const auto atMinusOne = leftValues[1] * rightValues[1];
+  const auto atMinusTwo = leftValues[2] * rightValues[2];
+  const auto atInfinity = leftParts[2] * rightParts[2];
+
+  auto r3 = (atMinusTwo - atOne) / 3;
+  auto r1 = (atOne - atMinusOne) / 2;
+  auto r2 = atMinusOne - atZero;
+  r3 = (r2 - r3) / 2 + atInfinity * 2;
+  r2 = r2 + r1 - atInfinity;
+  r1 = r1 - r3;
+
+  const auto resultSize = leftSize + rightSize;
+  const std::array<const SignedSlices *, 5> coefficients{&atZero, &r1, &r2, &r3, &atInfinity};
+  for (size_t i = 0; i < coefficients.size(); ++i) {
+    const auto &coefficient = *coefficients[i];
+    ensure(!coefficient.negative);
+    if (coefficient.magnitude.empty()) continue;
+
+    addSlicesInto(result + i * third, resultSize - i * third, coefficient.magnitude.data(),
+                  coefficient.magnitude.size());
+  }
+}
+
+// A number theoretic transform modulo a prime of the form k * 2^n + 1, with a primitive root, so it can transform up
+// to 2^n values. The modulus being a template argument lets the compiler turn every % into multiplications
+template <uint32_t Modulus, uint32_t PrimitiveRoot>
+struct NumberTheoreticTransform {
+  static constexpr uint32_t power(uint64_t base, uint64_t exponent) {
+    uint64_t result = 1;
+    for (base %= Modulus; exponent > 0; exponent >>= 1) {
+      if (exponent & 1) result = result * base % Modulus;
+      base = base * base % Modulus;
+    }
+    return static_cast<uint32_t>(result);
+  }
+
+  static constexpr uint32_t inverse(uint64_t value) { return power(value, Modulus - 2); }
+
+  static constexpr size_t maximumLength = size_t{1} << std::countr_zero(Modulus - 1);
+
+  static void transform(std::vector<uint32_t> *values, bool inverted) {
+    auto &a = *values;
+    const auto n = a.size();
+    ensure(std::has_single_bit(n) && n <= maximumLength);
+
+    for (size_t i = 1, j = 0; i < n; ++i) {
+      auto bit = n >> 1;
+      for (; j & bit; bit >>= 1) {
+        j ^= bit;
+      }
+      j ^= bit;
+      if (i < j) std::swap(a[i], a[j]);
+    }
+
+    // Next to each twiddle factor w we keep floor(w * 2^32 / Modulus), so multiplying by it needs no division, this is
+    // Shoup's modular multiplication
+    std::vector<uint32_t> twiddles(n / 2), twiddleQuotients(n / 2);
+    for (size_t length = 2; length <= n; length <<= 1) {
+      auto step = power(PrimitiveRoot, (Modulus - 1) / length);
+      if (inverted) step = inverse(step);
+
+      const auto half = length / 2;
+      twiddles[0] = 1;
+      for (size_t j = 1; j < half; ++j) {
+        twiddles[j] = static_cast<uint32_t>(static_cast<uint64_t>(twiddles[j - 1]) * step % Modulus);
+      }
+      for (size_t j = 0; j < half; ++j) {
+        twiddleQuotients[j] = static_cast<uint32_t>((static_cast<uint64_t>(twiddles[j]) << 32) / Modulus);
+      }
+
+      for (size_t i = 0; i < n; i += length) {
+        for (size_t j = 0; j < half; ++j) {
+          auto u = a[i + j];
+          auto x = a[i + j + half];
+          auto quotient = static_cast<uint32_t>((static_cast<uint64_t>(x) * twiddleQuotients[j]) >> 32);
+          auto v = x * twiddles[j] - quotient * Modulus; // Wraps around, but the result is always below 2 * Modulus
+          if (v >= Modulus) v -= Modulus;
+
+          a[i + j] = u + v >= Modulus ? u + v - Modulus : u + v;
+          a[i + j + half] = u >= v ? u - v : u + Modulus - v;
+        }
+      }
+    }
+
+    if (inverted) {
+      const auto scale = inverse(n);
+      for (auto &value : a) {
+        value = static_cast<uint32_t>(static_cast<uint64_t>(value) * scale % Modulus);
       }
     }
-    this->slices.push_back(result);
   }
+
+  // The convolution of left and right modulo Modulus, length has to be a power of two that fits the whole of it
+  static std::vector<uint32_t> convolve(const Integer::value_t *left, size_t leftSize, const Integer::value_t *right,
+                                        size_t rightSize, size_t length) {
+    std::vector<uint32_t> transformedLeft(length), transformedRight(length);
+    std::transform(left, left + leftSize, transformedLeft.begin(), [](auto slice) { return slice % Modulus; });
+    std::transform(right, right + rightSize, transformedRight.begin(), [](auto slice) { return slice % Modulus; });
+
+    transform(&transformedLeft, false);
+    transform(&transformedRight, false);
+    for (size_t i = 0; i < length; ++i) {
+      auto product = static_cast<uint64_t>(transformedLeft[i]) * transformedRight[i];
+      transformedLeft[i] = static_cast<uint32_t>(product % Modulus);
+    }
+    transform(&transformedLeft, true);
+    return transformedLeft;
+  }
+};
+
+// Three NTT-friendly primes, whose product is a bit over 2^85
+using FirstTransform = NumberTheoreticTransform<998244353, 3>;
+using SecondTransform = NumberTheoreticTransform<167772161, 3>;
+using ThirdTransform = NumberTheoreticTransform<469762049, 3>;
+
+constexpr uint64_t NTT_FIRST_PRIME = 998244353, NTT_SECOND_PRIME = 167772161, NTT_THIRD_PRIME = 469762049;
+constexpr auto NTT_MAXIMUM_LENGTH =
+    std::min({FirstTransform::maximumLength, SecondTransform::maximumLength, ThirdTransform::maximumLength});
+// Every term of the convolution sums up to rightSize products of two slices, and has to stay below the primes' product
+constexpr auto NTT_MAXIMUM_TERMS = static_cast<size_t>(
+    static_cast<unsigned __int128>(NTT_FIRST_PRIME * NTT_SECOND_PRIME) * NTT_THIRD_PRIME / SLICE_MAX / SLICE_MAX);
+
+// The length the transforms need to multiply these, or zero if they can't do it exactly
+inline size_t nttLength(size_t leftSize, size_t rightSize) {
+  auto length = std::bit_ceil(leftSize + rightSize);
+  return length <= NTT_MAXIMUM_LENGTH && std::min(leftSize, rightSize) <= NTT_MAXIMUM_TERMS ? length : 0;
 }
 
-Integer::Integer(intmax_t value) : _positive(value >= 0) {
-  value = std::abs(value);
-  while (value > 0) {
-    auto slice = value % static_cast<value_t>(SLICE_SIZE);
-    slices.push_back(static_cast<uintmax_t>(slice));
-    value = (value - slice) / SLICE_SIZE;
+// Multiplies with number theoretic transforms: the convolution of the slices modulo each of the three primes gets
+// combined with the Chinese remainder theorem, which is exact since no term gets as big as the primes' product.
+// The result has to hold leftSize + rightSize slices, all of them zeroed
+void multiplySlicesNtt(const Integer::value_t *left, size_t leftSize, const Integer::value_t *right, size_t rightSize,
+                       Integer::value_t *result) {
+  const auto length = nttLength(leftSize, rightSize);
+  ensure(length > 0);
+
+  const auto first = FirstTransform::convolve(left, leftSize, right, rightSize, length);
+  const auto second = SecondTransform::convolve(left, leftSize, right, rightSize, length);
+  const auto third = ThirdTransform::convolve(left, leftSize, right, rightSize, length);
+
+  // This is Garner's algorithm: term = r1 + p1 * t1 + p1 * p2 * t2, with t1 < p2 and t2 < p3
+  constexpr auto p1 = NTT_FIRST_PRIME, p2 = NTT_SECOND_PRIME, p3 = NTT_THIRD_PRIME;
+  constexpr uint64_t p1InverseModP2 = SecondTransform::inverse(p1);
+  constexpr uint64_t p1p2InverseModP3 = ThirdTransform::inverse(p1 * p2 % p3);
+
+  unsigned __int128 carryOver = 0;
+  for (size_t i = 0; i < leftSize + rightSize; ++i) {
+    uint64_t r1 = first[i], r2 = second[i], r3 = third[i];
+    auto t1 = (r2 + p2 - r1 % p2) * p1InverseModP2 % p2;
+    auto t2 = (r3 + p3 - (r1 + p1 % p3 * t1) % p3) * p1p2InverseModP3 % p3;
+
+    carryOver += r1 + static_cast<unsigned __int128>(p1) * t1 + static_cast<unsigned __int128>(p1 * p2) * t2;
+    result[i] = static_cast<Integer::value_t>(carryOver);
+    carryOver >>= SLICE_BITS;
   }
-  slices.shrink_to_fit();
+  ensure(carryOver == 0);
 }
 
-std::string Integer::toString() const {
-  if (slices.empty()) {
-    ensure(_positive);
-    return "0";
+// result has to hold leftSize + rightSize slices, all of them zeroed
+void multiplySlices(const Integer::value_t *left, size_t leftSize, const Integer::value_t *right, size_t rightSize,
+                    Integer::value_t *result) {
+  if (leftSize < rightSize) {
+    std::swap(left, right);
+    std::swap(leftSize, rightSize);
+  }
+
+  if (rightSize < std::max<size_t>(Integer::karatsubaThreshold, 2)) {
+    multiplySlicesSchoolbook(left, leftSize, right, rightSize, result);
+    return;
+  }
+
+  if (rightSize >= Integer::nttThreshold && nttLength(leftSize, rightSize) > 0) {
+    multiplySlicesNtt(left, leftSize, right, rightSize, result);
+    return;
+  }
+
+  if (leftSize >= rightSize * 2) {
+    // Karatsuba and Toom-Cook work best with balanced operands, so we multiply right by left one rightSize-sized
+    // chunk at a time
+    std::vector<Integer::value_t> partial(rightSize * 2);
+    for (size_t offset = 0; offset < leftSize; offset += rightSize) {
+      auto chunkSize = std::min(rightSize, leftSize - offset);
+      std::fill(partial.begin(), partial.end(), 0);
+      multiplySlices(left + offset, chunkSize, right, rightSize, partial.data());
+      addSlicesInto(result + offset, leftSize + rightSize - offset, partial.data(), chunkSize + rightSize);
+    }
+    return;
+  }
+
+  if (rightSize >= std::max<size_t>(Integer::toomCookThreshold, 3)) {
+    multiplySlicesToomCook(left, leftSize, right, rightSize, result);
+  } else {
+    multiplySlicesKaratsuba(left, leftSize, right, rightSize, result);
+  }
+}
+
+// Divides [dividend, dividend + size) by divisor, writing size slices into quotient and returning the remainder
+inline Integer::value_t divideSlicesBySlice(const Integer::value_t *dividend, size_t size, Integer::value_t divisor,
+                                            Integer::value_t *quotient) {
+  uint64_t remainder = 0;
+  for (auto i = size; i > 0; --i) {
+    uint64_t current = (remainder << SLICE_BITS) | dividend[i - 1];
+    quotient[i - 1] = static_cast<Integer::value_t>(current / divisor);
+    remainder = current % divisor;
+  }
+  return static_cast<Integer::value_t>(remainder);
+}
+
+// slices = slices * multiplier + addend
+inline void multiplyAddSlice(Integer::slices_t *slices, Integer::value_t multiplier, Integer::value_t addend) {
+  uint64_t carryOver = addend;
+  for (auto &slice : *slices) {
+    uint64_t current = static_cast<uint64_t>(slice) * multiplier + carryOver;
+    slice = static_cast<Integer::value_t>(current);
+    carryOver = current >> SLICE_BITS;
   }
+  if (carryOver) slices->push_back(static_cast<Integer::value_t>(carryOver));
+}
 
-  std::string result;
-  for (auto slice : slices) {
-    auto nextSlice = std::to_string(slice);
-    auto paddedSlice = Puzzles::padLeading(nextSlice, 9, '0');
-    result.insert(0, paddedSlice);
+// Shifts [source, source + size) left by less than a slice, writing size + 1 slices into target
+inline void shiftSlicesLeft(const Integer::value_t *source, size_t size, int bits, Integer::value_t *target) {
+  ensure(bits >= 0 && bits < SLICE_BITS);
+
+  Integer::value_t carryOver = 0;
+  for (size_t i = 0; i < size; ++i) {
+    target[i] = (source[i] << bits) | carryOver;
+    carryOver = bits == 0 ? 0 : source[i] >> (SLICE_BITS - bits);
   }
+  target[size] = carryOver;
+}
+
+// This is Knuth's Algorithm D (TAOCP Vol. 2, 4.3.1), divisor has to have at least two slices and can't be bigger than
+// the dividend. quotient has to hold dividend.size() - divisor.size() + 1 slices, and the remainder gets returned
+Integer::slices_t divideSlices(const Integer::slices_t &dividend, const Integer::slices_t &divisor,
+                               Integer::value_t *quotient) {
+  const auto n = divisor.size();
+  const auto m = dividend.size() - n;
+  ensure(n >= 2 && divisor.back() != 0);
+
+  // Normalizing, so the divisor's most significant bit is set and the estimates are good
+  const auto shift = std::countl_zero(divisor.back());
+
+  Integer::slices_t normalizedDividend(dividend.size() + 1);
+  shiftSlicesLeft(dividend.data(), dividend.size(), shift, normalizedDividend.data());
+  Integer::slices_t normalizedDivisor(n + 1);
+  shiftSlicesLeft(divisor.data(), n, shift, normalizedDivisor.data());
+  ensure(normalizedDivisor.back() == 0);
+
+  const uint64_t divisorHigh = normalizedDivisor[n - 1];
+  const uint64_t divisorLow = normalizedDivisor[n - 2];
+
+  for (auto j = m + 1; j > 0; --j) {
+    auto current = normalizedDividend.data() + j - 1;
+
+    // Estimating the next quotient slice from the two most significant slices, it's at most 2 units too big
+    uint64_t numerator = (static_cast<uint64_t>(current[n]) << SLICE_BITS) | current[n - 1];
+    uint64_t estimate = numerator / divisorHigh;
+    uint64_t estimateRemainder = numerator % divisorHigh;
+    while (estimate >= SLICE_SIZE ||
+           estimate * divisorLow > ((estimateRemainder << SLICE_BITS) | current[n - 2])) {
+      --estimate;
+      estimateRemainder += divisorHigh;
+      if (estimateRemainder >= SLICE_SIZE) break;
+    }
+
+    // current -= estimate * divisor
+    uint64_t carryOver = 0;
+    uint64_t borrow = 0;
+    for (size_t i = 0; i < n; ++i) {
+      uint64_t product = estimate * normalizedDivisor[i] + carryOver;
+      carryOver = product >> SLICE_BITS;
+      uint64_t difference = static_cast<uint64_t>(current[i]) - static_cast<Integer::value_t>(product) - borrow;
+      current[i] = static_cast<Integer::value_t>(difference);
+      borrow = (difference >> SLICE_BITS) & 1;
+    }
+    uint64_t difference = static_cast<uint64_t>(current[n]) - carryOver - borrow;
+    current[n] = static_cast<Integer::value_t>(difference);
+
+    if (difference >> SLICE_BITS) {
+      // The estimate was still one unit too big, so we add one divisor back
+      --estimate;
+      uint64_t addCarryOver = 0;
+      for (size_t i = 0; i < n; ++i) {
+        uint64_t sum = static_cast<uint64_t>(current[i]) + normalizedDivisor[i] + addCarryOver;
+        current[i] = static_cast<Integer::value_t>(sum);
+        addCarryOver = sum >> SLICE_BITS;
+      }
+      current[n] = 0; // The last carry over just cancels the borrow from before
+    }
+
+    quotient[j - 1] = static_cast<Integer::value_t>(estimate);
+  }
+
+  // Denormalizing the remainder
+  Integer::slices_t remainder(n);
+  for (size_t i = 0; i < n; ++i) {
+    auto high = static_cast<uint64_t>(normalizedDividend[i + 1]) << SLICE_BITS;
+    remainder[i] = static_cast<Integer::value_t>((high | normalizedDividend[i]) >> shift);
+  }
+  return remainder;
+}
+
+// The value of at most two slices
+inline uint64_t wordOf(const Integer::slices_t &slices) {
+  ensure(slices.size() <= 2);
+
+  uint64_t word = 0;
+  for (auto it = slices.crbegin(); it != slices.crend(); ++it) {
+    word = (word << SLICE_BITS) | *it;
+  }
+  return word;
+}
+
+inline size_t bitLength(const Integer::slices_t &slices) {
+  if (slices.empty()) return 0;
+  return (slices.size() - 1) * SLICE_BITS + static_cast<size_t>(std::bit_width(slices.back()));
+}
+
+// The 64 bits of slices starting at the offset-th one
+inline uint64_t bitsAt(const Integer::slices_t &slices, size_t offset) {
+  auto index = offset / SLICE_BITS;
+  unsigned __int128 window = 0;
+  for (auto i = std::min(index + 3, slices.size()); i > index; --i) {
+    window = (window << SLICE_BITS) | slices[i - 1];
+  }
+  return static_cast<uint64_t>(window >> (offset % SLICE_BITS));
+}
 
-  result = Puzzles::trimLeading(result, '0');
+// left * leftFactor + right * rightFactor, which has to be non-negative
+Integer::slices_t linearCombination(const Integer::slices_t &left, int64_t leftFactor, const Integer::slices_t &right,
+                                    int64_t rightFactor) {
+  ensure(left.size() >= right.size());
 
-  if (!_positive) {
-    result.insert(0, 1, '-');
+  Integer::slices_t result(left.size());
+  __int128 carryOver = 0;
+  for (size_t i = 0; i < left.size(); ++i) {
+    __int128 current = carryOver + static_cast<__int128>(left[i]) * leftFactor;
+    if (i < right.size()) current += static_cast<__int128>(right[i]) * rightFactor;
+
+    result[i] = static_cast<Integer::value_t>(current);
+    carryOver = current >> SLICE_BITS; // Arithmetic shift, so negative carries work as borrows
   }
+  ensure(carryOver == 0);
 
+  result.resize(significantSlices(result.data(), result.size()));
   return result;
 }
 
-inline compat::strong_ordering compareSlices(const std::vector<Integer::value_t> &left,
-                                             const std::vector<Integer::value_t> &right) {
+inline compat::strong_ordering compareSlices(const Integer::slices_t &left, const Integer::slices_t &right) {
   auto lengthComparison = compat::compare(left.size(), right.size());
   if (lengthComparison != compat::strong_ordering::equal) {
     return lengthComparison;
@@ -121,208 +645,491 @@ inline compat::strong_ordering compareSlices(const std::vector<Integer::value_t>
   return compat::strong_ordering::equal;
 }
 
-Integer Integer::operator+(const Integer &o) const {
-  if (slices.empty()) return o;
-  if (o.slices.empty()) return *this;
+inline Integer::slices_t multipliedSlices(const Integer::slices_t &left, const Integer::slices_t &right) {
+  if (left.empty() || right.empty()) return {};
 
-  auto sameSign = this->positive() == o.positive();
-  if (!sameSign && this->slices == o.slices) {
-    return Integer(0);
+  Integer::slices_t result(left.size() + right.size());
+  multiplySlices(left.data(), left.size(), right.data(), right.size(), result.data());
+  result.resize(significantSlices(result.data(), result.size()));
+  return result;
+}
+
+// target += source
+inline void addSlices(Integer::slices_t *target, const Integer::slices_t &source) {
+  target->resize(std::max(target->size(), source.size()));
+  if (addSlicesWithCarry(target->data(), target->size(), source.data(), source.size())) {
+    target->push_back(1);
   }
+}
 
-  bool finalSign;
-  typeof(slices.cbegin()) lit, rit;
-  typeof(slices.cend()) lend, rend;
+// target -= source, where target can't be the smallest one
+inline void subtractSlices(Integer::slices_t *target, const Integer::slices_t &source) {
+  subtractSlicesFrom(target->data(), target->size(), source.data(), source.size());
+  target->resize(significantSlices(target->data(), target->size()));
+}
 
-  // if sameSign, we don't care about the order, so we can avoid the compareSlices call
-  if (sameSign || compareSlices(this->slices, o.slices) != compat::strong_ordering::less) {
-    finalSign = this->_positive;
-    lit = this->slices.cbegin();
-    lend = this->slices.cend();
+// The slices from the offset-th one onwards, so a floor division by SLICE_SIZE^offset
+inline Integer::slices_t slicesFrom(const Integer::slices_t &slices, size_t offset) {
+  if (offset >= slices.size()) return {};
 
-    rit = o.slices.cbegin();
-    rend = o.slices.cend();
-  } else {
-    finalSign = o._positive;
-    lit = o.slices.cbegin();
-    lend = o.slices.cend();
+  Integer::slices_t result(slices.size() - offset);
+  std::copy_n(slices.data() + offset, result.size(), result.data());
+  return result;
+}
 
-    rit = this->slices.cbegin();
-    rend = this->slices.cend();
+// The slices before the offset-th one, so the remainder of a division by SLICE_SIZE^offset
+inline Integer::slices_t slicesUntil(const Integer::slices_t &slices, size_t offset) {
+  Integer::slices_t result{slices.data(), slices.data() + std::min(offset, slices.size())};
+  result.resize(significantSlices(result.data(), result.size()));
+  return result;
+}
+
+// slices * SLICE_SIZE^offset
+inline Integer::slices_t slicesShiftedUp(const Integer::slices_t &slices, size_t offset) {
+  if (slices.empty()) return {};
+
+  Integer::slices_t result(slices.size() + offset);
+  std::copy(slices.begin(), slices.end(), result.begin() + static_cast<ptrdiff_t>(offset));
+  return result;
+}
+
+// SLICE_SIZE^exponent
+inline Integer::slices_t slicePower(size_t exponent) {
+  Integer::slices_t result(exponent + 1);
+  result.back() = 1;
+  return result;
+}
+
+// Shifts slices right by less than a slice, in place
+inline void shiftSlicesRight(Integer::slices_t *slices, int bits) {
+  ensure(bits >= 0 && bits < SLICE_BITS);
+  if (bits == 0) return;
+
+  auto data = slices->data();
+  for (size_t i = 0; i < slices->size(); ++i) {
+    auto high = i + 1 < slices->size() ? data[i + 1] << (SLICE_BITS - bits) : 0;
+    data[i] = (data[i] >> bits) | high;
   }
+  slices->resize(significantSlices(data, slices->size()));
+}
 
-  std::vector<value_t> result;
-  result.reserve(std::max(this->slices.size(), o.slices.size()) + 1);
+// Shifts slices left by less than a slice, into a new vector
+inline Integer::slices_t slicesShiftedLeft(const Integer::slices_t &slices, int bits) {
+  Integer::slices_t result(slices.size() + 1);
+  shiftSlicesLeft(slices.data(), slices.size(), bits, result.data());
+  result.resize(significantSlices(result.data(), result.size()));
+  return result;
+}
 
-  int_fast64_t carryOver = 0;
+// The size-slice two's complement representation of a value, where size has room for the sign bit
+Integer::slices_t twosComplement(const Integer::slices_t &magnitude, bool positive, size_t size) {
+  ensure(size > magnitude.size());
+
+  Integer::slices_t result(size);
+  std::copy(magnitude.begin(), magnitude.end(), result.begin());
+  if (!positive) {
+    // -m == ~(m - 1)
+    for (auto &slice : result) {
+      if (slice-- != 0) break;
+    }
+    for (auto &slice : result) {
+      slice = ~slice;
+    }
+  }
+  return result;
+}
+
+// The reverse of twosComplement, writing the magnitude in place and returning whether it's positive
+bool fromTwosComplement(Integer::slices_t *slices) {
+  auto positive = (slices->back() >> (SLICE_BITS - 1)) == 0;
+  if (!positive) {
+    // -(~m + 1) == ~m + 1 when m is negative
+    for (auto &slice : *slices) {
+      slice = ~slice;
+    }
+    for (auto &slice : *slices) {
+      if (++slice != 0) break;
+    }
+  }
+  slices->resize(significantSlices(slices->data(), slices->size()));
+  return positive;
+}
 
-  while (lit != lend || rit != rend) {
-    int_fast64_t lbit = lit == lend ? 0 : valueAndAdvance<value_t>(&lit);
-    int_fast64_t rbit = rit == rend ? 0 : valueAndAdvance<value_t>(&rit);
-    int_fast64_t sum = sameSign ? lbit + rbit + carryOver : lbit - rbit - carryOver;
+// Roughly floor(SLICE_SIZE^(2n) / divisor), give or take a few units, where divisor has n slices and its most
+// significant bit set
+Integer::slices_t reciprocalOf(const Integer::slices_t &divisor) {
+  const auto n = divisor.size();
+  ensure(n > 0 && std::countl_zero(divisor.back()) == 0);
 
-    ensure(sum >= (SLICE_SIZE * static_cast<intmax_t>(-1)) && sum <= (SLICE_SIZE * 2 - 1));
+  const auto target = slicePower(n * 2);
 
-    if (sum < 0) {
-      carryOver = 1;
-      sum += SLICE_SIZE;
-    } else if (sum > SLICE_MAX) {
-      carryOver = 1;
-      sum -= SLICE_SIZE;
+  if (n <= std::max<size_t>(Integer::karatsubaThreshold, 2)) {
+    Integer::slices_t result(n + 2);
+    if (n == 1) {
+      divideSlicesBySlice(target.data(), target.size(), divisor[0], result.data());
     } else {
-      carryOver = 0;
+      divideSlices(target, divisor, result.data());
     }
+    result.resize(significantSlices(result.data(), result.size()));
+    return result;
+  }
 
-    result.push_back(sum);
+  // This is Newton's method: the top half of the divisor gives us a reciprocal that's right on about half of its
+  // slices, and each iteration of x + x * (1 - divisor * x) doubles that
+  const auto low = n / 2;
+  const auto half = reciprocalOf(slicesFrom(divisor, low));
+  auto result = slicesShiftedUp(half, low);
+
+  auto product = slicesShiftedUp(multipliedSlices(divisor, half), low);
+  if (compareSlices(product, target) != compat::strong_ordering::greater) {
+    auto error = target;
+    subtractSlices(&error, product);
+    addSlices(&result, slicesFrom(multipliedSlices(half, error), n * 2 - low));
+  } else {
+    auto error = std::move(product);
+    subtractSlices(&error, target);
+    subtractSlices(&result, slicesFrom(multipliedSlices(half, error), n * 2 - low));
   }
 
-  ensure_m(carryOver == 0 || (carryOver == 1 && sameSign), "carry over is " << carryOver);
-  if (carryOver) result.push_back(1);
+  return result;
+}
 
-  while (result.back() == 0) {
-    result.pop_back();
-    ensure_m(!result.empty(), "sum is 0, but we should've left the function at the beginning");
+// Divides by the same value over and over, computing its reciprocal only once. This takes a few multiplications per
+// division instead of the quadratic long division, which pays off once both operands are big
+struct ReciprocalDivisor {
+  explicit ReciprocalDivisor(const Integer::slices_t &divisor)
+      : shift{std::countl_zero(divisor.back())}, normalized{slicesShiftedLeft(divisor, shift)},
+        reciprocal{reciprocalOf(normalized)} {}
+
+  void divide(const Integer::slices_t &dividend, Integer::slices_t *quotient, Integer::slices_t *remainder) const {
+    // Shifting both by the same amount doesn't change the quotient, only the remainder
+    const auto n = normalized.size();
+    const auto shifted = slicesShiftedLeft(dividend, shift);
+
+    // Going through the dividend n slices at a time, so every partial dividend stays below normalized * SLICE_SIZE^n
+    const auto blocks = (shifted.size() + n - 1) / n;
+    quotient->clear();
+    quotient->resize(blocks * n);
+    remainder->clear();
+
+    for (auto block = blocks; block > 0; --block) {
+      const auto offset = (block - 1) * n;
+      auto current = slicesShiftedUp(*remainder, n);
+      current.resize(std::max(current.size(), n));
+      for (size_t i = 0; i < n && offset + i < shifted.size(); ++i) {
+        current[i] = shifted[offset + i];
+      }
+      current.resize(significantSlices(current.data(), current.size()));
+
+      // The top n + 1 slices are enough to estimate the quotient within a few units, so we fix it from there
+      auto partial = slicesFrom(multipliedSlices(slicesFrom(current, n - 1), reciprocal), n + 1);
+      auto product = multipliedSlices(partial, normalized);
+      while (compareSlices(product, current) == compat::strong_ordering::greater) {
+        subtractSlices(&partial, Integer::slices_t(1, 1));
+        subtractSlices(&product, normalized);
+      }
+
+      *remainder = std::move(current);
+      subtractSlices(remainder, product);
+      while (compareSlices(*remainder, normalized) != compat::strong_ordering::less) {
+        subtractSlices(remainder, normalized);
+        addSlices(&partial, Integer::slices_t(1, 1));
+      }
+
+      ensure(partial.size() <= n);
+      std::copy(partial.begin(), partial.end(), quotient->begin() + static_cast<ptrdiff_t>(offset));
+    }
+
+    quotient->resize(significantSlices(quotient->data(), quotient->size()));
+    shiftSlicesRight(remainder, shift);
   }
 
-  return Integer(result, finalSign);
-}
+  const int shift;
+  const Integer::slices_t normalized;
+  const Integer::slices_t reciprocal;
+};
+
+// Divides dividend by divisor, picking the best algorithm for their sizes
+void divideSlicesInto(const Integer::slices_t &dividend, const Integer::slices_t &divisor, Integer::slices_t *quotient,
+                      Integer::slices_t *remainder) {
+  ensure(!divisor.empty());
+
+  if (compareSlices(dividend, divisor) == compat::strong_ordering::less) {
+    quotient->clear();
+    *remainder = dividend;
+    return;
+  }
 
-Integer Integer::operator-(const Integer &o) const {
-  if (this->slices.empty()) return Integer{o.slices, !o._positive};
-  if (*this == o) return Integer{0};
+  const auto quotientSize = dividend.size() - divisor.size() + 1;
+  if (std::min(divisor.size(), quotientSize) >= Integer::newtonDivisionThreshold) {
+    ReciprocalDivisor{divisor}.divide(dividend, quotient, remainder);
+    return;
+  }
 
-  if (this->positive() == o.positive() && o.slices.size() == 1 && o.slices[0] <= this->slices[0]) {
+  quotient->resize(quotientSize);
+  if (divisor.size() == 1) {
     // Optimizing this common scenario
-    Integer newInteger{*this};
-    newInteger.slices[0] -= o.slices[0];
-    return newInteger;
+    auto lastRemainder = divideSlicesBySlice(dividend.data(), dividend.size(), divisor[0], quotient->data());
+    remainder->clear();
+    if (lastRemainder != 0) remainder->push_back(lastRemainder);
+  } else {
+    *remainder = divideSlices(dividend, divisor, quotient->data());
   }
 
-  return *this + Integer{o.slices, !o._positive};
+  quotient->resize(significantSlices(quotient->data(), quotient->size()));
+  remainder->resize(significantSlices(remainder->data(), remainder->size()));
 }
 
-Integer Integer::operator*(const Integer &o) const {
-  if (slices.empty() || o.slices.empty()) return Integer{0};
+// Calls operation(bit, isLastBit) for every bit in slices, starting from the least significant one
+template <typename Operation>
+inline void forEachBit(const Integer::slices_t &slices, const Operation &operation) {
+  for (size_t i = 0; i < slices.size(); ++i) {
+    auto slice = slices[i];
+    auto isLastSlice = i + 1 == slices.size();
+    auto bits = isLastSlice ? static_cast<int>(std::bit_width(slice)) : SLICE_BITS;
 
-  auto min = this->absolute();
-  auto max = o.absolute();
+    for (auto bit = 0; bit < bits; ++bit) {
+      operation(((slice >> bit) & 1) == 1, isLastSlice && bit + 1 == bits);
+    }
+  }
+}
+
+// Parses a string of decimal digits, splitting it in two halves around a power of 10^9 from powers, which are
+// 10^(9 * 2^level) for every level, squaring the last one whenever we need a bigger one (or the first one)
+Integer::slices_t parseDecimal(std::string_view digits, std::vector<Integer::slices_t> *powers) {
+  Integer::slices_t result;
+
+  if (digits.length() <= DECIMAL_BASE_CASE_SLICES * DECIMAL_CHUNK_DIGITS) {
+    // Reading DECIMAL_CHUNK_DIGITS digits at a time, starting from the most significant ones
+    auto chunkLength = digits.length() % DECIMAL_CHUNK_DIGITS;
+    if (chunkLength == 0) chunkLength = DECIMAL_CHUNK_DIGITS;
+
+    while (!digits.empty()) {
+      Integer::value_t chunk = 0;
+      for (auto digit : digits.substr(0, chunkLength)) {
+        chunk = chunk * 10 + static_cast<Integer::value_t>(digit - '0');
+      }
+      digits = digits.substr(chunkLength);
+      chunkLength = DECIMAL_CHUNK_DIGITS;
+
+      multiplyAddSlice(&result, DECIMAL_CHUNK_SIZE, chunk);
+    }
 
-  if (compareSlices(this->slices, o.slices) == compat::strong_ordering::greater) {
-    std::swap(min, max);
+    result.resize(significantSlices(result.data(), result.size()));
+    return result;
   }
 
-  Integer result{0};
-  for (Integer i{0}; i < min; ++i) {
-    result += max;
+  size_t level = 0;
+  while ((static_cast<size_t>(DECIMAL_CHUNK_DIGITS) << (level + 1)) < digits.length()) {
+    ++level;
+  }
+  if (powers->empty()) powers->emplace_back(1, DECIMAL_CHUNK_SIZE);
+  while (powers->size() <= level) {
+    powers->push_back(multipliedSlices(powers->back(), powers->back()));
   }
 
-  result._positive = this->positive() == o.positive();
+  const auto lowLength = static_cast<size_t>(DECIMAL_CHUNK_DIGITS) << level;
+  const auto highDigits = digits.substr(0, digits.length() - lowLength);
+  const auto lowDigits = digits.substr(digits.length() - lowLength);
+
+  result = multipliedSlices(parseDecimal(highDigits, powers), (*powers)[level]);
+  addSlices(&result, parseDecimal(lowDigits, powers));
   return result;
 }
 
-Integer Integer::operator/(const Integer &o) const {
-  ensure(o != 0); // division by zero is undefined
-
-  if (slices.empty()) { // Zero divided by anything is always zero
-    return *this;
+// Writes DECIMAL_CHUNK_DIGITS digits, leading zeroes included, right before end
+inline void writeDecimalChunk(Integer::value_t chunk, char *end) {
+  for (auto i = 0; i < DECIMAL_CHUNK_DIGITS / 2; ++i) {
+    auto pair = static_cast<size_t>(chunk % 100) * 2;
+    chunk /= 100;
+    end -= 2;
+    end[0] = DIGIT_PAIRS[pair];
+    end[1] = DIGIT_PAIRS[pair + 1];
   }
+  *(end - 1) = static_cast<char>('0' + chunk);
+}
 
-  // if (this < o) then (this / o) will be a fraction, which we don't support
-  ensure_m(o.absolute() <= this->absolute(),
-           "this is [" << std::to_string(*this) << "], o is [" << std::to_string(o) << "]");
-
-  // Now for the actual division implementation
-  Integer remainder{this->slices, true};
-  Integer result{0};
-
-  if (o.slices.size() == 1) {
-    // Optimizing this common scenario
-    auto base = o.slices[0];
-    std::vector<std::pair<intmax_t, intmax_t>> stepSizes;
-    stepSizes.emplace_back(1, base);
-
-    constexpr auto max = std::numeric_limits<intmax_t>::max() / 2;
-    for (intmax_t i = 2; i <= max && (*this > stepSizes.back().second); i *= 2) {
-      stepSizes.emplace_back(i, i * base);
-    }
-
-    for (auto it = stepSizes.crbegin(); it != stepSizes.crend(); ++it) {
-      auto [i, stepSize] = *it;
-      Integer step{stepSize};
-      while (step <= remainder) {
-        remainder -= step;
-        result = result + i;
-        ensure(remainder.positive()); // We don't support fractions, to we should always stop exactly at 0
+struct DecimalWriter {
+  // 10^(9 * 2^level), for every level we need
+  std::vector<Integer::slices_t> powers;
+  std::vector<std::optional<ReciprocalDivisor>> divisors;
+
+  // Writes exactly DECIMAL_CHUNK_DIGITS * 2^level digits right before end, assuming the buffer is full of zeroes
+  void write(const Integer::slices_t &value, size_t level, char *end) {
+    if (level == 0 || value.size() <= DECIMAL_BASE_CASE_SLICES) {
+      // Peeling off DECIMAL_CHUNK_DIGITS digits at a time, starting from the least significant ones
+      auto remaining = value;
+      while (!remaining.empty()) {
+        auto chunk = divideSlicesBySlice(remaining.data(), remaining.size(), DECIMAL_CHUNK_SIZE, remaining.data());
+        remaining.resize(significantSlices(remaining.data(), remaining.size()));
+        writeDecimalChunk(chunk, end);
+        end -= DECIMAL_CHUNK_DIGITS;
       }
+      return;
     }
-  } else {
-    auto step = o.absolute();
 
-    while (!remainder.slices.empty()) {
-      remainder -= step;
-      ++result;
-      ensure(remainder.positive()); // We don't support fractions, to we should always stop exactly at 0
+    // Splitting the value into its high and low halves, in decimal
+    const auto &power = powers[level - 1];
+    Integer::slices_t high, low;
+    if (power.size() >= Integer::newtonDivisionThreshold) {
+      if (!divisors[level - 1]) divisors[level - 1].emplace(power);
+      divisors[level - 1]->divide(value, &high, &low);
+    } else {
+      divideSlicesInto(value, power, &high, &low);
     }
+
+    write(high, level - 1, end - (static_cast<size_t>(DECIMAL_CHUNK_DIGITS) << (level - 1)));
+    write(low, level - 1, end);
   }
+};
 
-  result._positive = this->positive() == o.positive() || result.slices.empty();
-  return result;
+Integer::Integer(const std::string &value) : _positive(value.empty() || value[0] != '-') {
+  if (value.empty() || value == "0") {
+    ensure(_positive); // Can't have negative zero
+    return;
+  }
+
+  std::string_view offset{value};
+  if (offset[0] == '-') {
+    offset = offset.substr(1);
+  }
+  ensure(offset.substr(1).find_first_not_of("0123456789") == value.npos);
+
+  std::vector<slices_t> powers;
+  slices = parseDecimal(offset, &powers);
+
+  _positive = _positive || slices.empty();
 }
 
-Integer Integer::operator%(const Integer &o) const {
-  ensure(o != 0); // division by zero is undefined
+Integer::Integer(intmax_t value) : _positive(value >= 0) {
+  auto magnitude = magnitudeOf(value);
+  while (magnitude > 0) {
+    slices.push_back(static_cast<value_t>(magnitude));
+    magnitude >>= SLICE_BITS;
+  }
+}
 
-  if (slices.empty()) { // Zero divided by anything is always zero
-    return *this;
+std::string Integer::toString() const {
+  if (slices.empty()) {
+    ensure(_positive);
+    return "0";
   }
 
-  Integer remainder{this->slices, true};
+  // We need a power of 10^9 that's bigger than us, squaring is the quickest way to get there, and we can tell it'll
+  // be bigger from its size alone, so we don't need to compute the last one
+  DecimalWriter writer{{slices_t(1, DECIMAL_CHUNK_SIZE)}, {}};
+  size_t levels = 1;
+  while (compareSlices(writer.powers.back(), slices) != compat::strong_ordering::greater) {
+    ++levels;
+    if (writer.powers.back().size() * 2 - 1 > slices.size()) break;
+    writer.powers.push_back(multipliedSlices(writer.powers.back(), writer.powers.back()));
+  }
+  writer.divisors.resize(writer.powers.size());
 
-  if (o.slices.size() == 1) {
-    // Optimizing this common scenario
-    auto base = o.slices[0];
-    std::vector<intmax_t> stepSizes;
-    stepSizes.push_back(base);
+  const auto width = static_cast<size_t>(DECIMAL_CHUNK_DIGITS) << (levels - 1);
+  std::string result(width + 1, '0');
+  writer.write(slices, levels - 1, result.data() + result.size());
 
-    constexpr auto max = std::numeric_limits<intmax_t>::max() / 2;
-    for (intmax_t i = 2; i <= max && (*this > stepSizes.back()); i *= 2) {
-      stepSizes.push_back(i * base);
-    }
+  auto first = result.find_first_not_of('0', 1);
+  if (!_positive) result[--first] = '-';
+  return result.substr(first);
+}
 
-    for (auto it = stepSizes.crbegin(); it != stepSizes.crend(); ++it) {
-      auto stepSize = *it;
-      Integer step{stepSize};
-      while (step <= remainder) {
-        remainder -= stepSize;
-      }
-    }
-  } else {
-    auto step = o.absolute();
-    while (step <= remainder) {
-      remainder -= step;
-    }
+size_t Integer::bitLength() const {
+  return ::bitLength(slices);
+}
+
+std::optional<intmax_t> Integer::toIntmax() const {
+  if (slices.size() > 2) return std::nullopt;
+
+  auto magnitude = wordOf(slices);
+  if (magnitude > static_cast<uint64_t>(INTMAX_MAX) + (_positive ? 0 : 1)) return std::nullopt;
+  return _positive ? static_cast<intmax_t>(magnitude) : -static_cast<intmax_t>(magnitude - 1) - 1;
+}
+
+Integer Integer::operator+(const Integer &o) const & {
+  if (slices.empty()) return o;
+  if (o.slices.empty()) return *this;
+
+  auto sameSign = this->positive() == o.positive();
+  if (sameSign) {
+    const auto &[longer, shorter] = this->slices.size() >= o.slices.size() ? std::tie(this->slices, o.slices)
+                                                                           : std::tie(o.slices, this->slices);
+    slices_t result(longer.size() + 1);
+    std::copy(longer.begin(), longer.end(), result.begin());
+    addSlicesInto(result.data(), result.size(), shorter.data(), shorter.size());
+    if (result.back() == 0) result.pop_back();
+
+    return Integer(std::move(result), this->positive());
   }
 
-  remainder._positive = this->positive() == o.positive() || remainder.slices.empty();
-  return remainder;
+  // Different signs, so we subtract the smaller magnitude from the bigger one, and keep the bigger one's sign
+  auto comparison = compareSlices(this->slices, o.slices);
+  if (comparison == compat::strong_ordering::equal) {
+    return Integer(0);
+  }
+
+  const auto &bigger = comparison == compat::strong_ordering::greater ? *this : o;
+  const auto &smaller = comparison == compat::strong_ordering::greater ? o : *this;
+
+  slices_t result{bigger.slices};
+  subtractSlicesFrom(result.data(), result.size(), smaller.slices.data(), smaller.slices.size());
+  result.resize(significantSlices(result.data(), result.size()));
+
+  return Integer(std::move(result), bigger.positive());
 }
 
-Integer Integer::operator+(intmax_t value) const {
+Integer Integer::operator-(const Integer &o) const & {
+  Integer result{*this};
+  result -= o;
+  return result;
+}
+
+Integer Integer::operator*(const Integer &o) const {
+  if (slices.empty() || o.slices.empty()) return Integer{0};
+
+  slices_t result(this->slices.size() + o.slices.size());
+  multiplySlices(this->slices.data(), this->slices.size(), o.slices.data(), o.slices.size(), result.data());
+
+  while (result.back() == 0) {
+    result.pop_back();
+  }
+
+  return Integer(std::move(result), this->positive() == o.positive());
+}
+
+std::pair<Integer, Integer> Integer::divmod(const Integer &o) const {
+  ensure(o != 0); // division by zero is undefined
+
+  if (compareSlices(this->slices, o.slices) == compat::strong_ordering::less) {
+    // This also covers zero divided by anything, which is always zero
+    return std::make_pair(Integer{0}, *this);
+  }
+
+  slices_t quotient, remainder;
+  divideSlicesInto(this->slices, o.slices, &quotient, &remainder);
+
+  // We truncate towards zero, so the remainder always has the same sign as the dividend
+  return std::make_pair(Integer{std::move(quotient), this->positive() == o.positive()},
+                        Integer{std::move(remainder), this->positive()});
+}
+
+Integer Integer::operator+(intmax_t value) const & {
   if (value == 0) return *this;
   if (slices.empty()) return Integer{value};
 
   auto sameSign = (value >= 0 && this->positive()) || (value < 0 && !this->positive());
-  auto absValue = std::abs(value);
-  if (sameSign && absValue + slices[0] < 1000000000) {
+  auto absValue = magnitudeOf(value);
+  if (sameSign && absValue <= SLICE_MAX - slices[0]) {
     Integer result{*this};
-    result.slices[0] += absValue;
+    result.slices[0] += static_cast<value_t>(absValue);
     return result;
   }
 
   return *this + Integer{value};
 }
 
-Integer Integer::operator*(intmax_t value) const {
+Integer Integer::operator*(intmax_t value) const & {
   switch (value) {
   case 0:
     return Integer{0};
@@ -331,7 +1138,9 @@ Integer Integer::operator*(intmax_t value) const {
   case -1:
     return Integer{slices, !_positive};
   default:
-    return *this * Integer(value);
+    Integer result{*this};
+    result *= value;
+    return result;
   }
 }
 
@@ -339,15 +1148,194 @@ Integer Integer::power(const Integer &exponent) const {
   ensure(*this != 0 || exponent != 0); // zero ^ zero is undefined
   ensure(exponent.positive());         // Haven't implemented this yet
 
+  // This is exponentiation by squaring, going through the exponent's bits from the least significant one
   Integer result{1};
+  Integer base{*this};
 
-  for (Integer i{0}; i < exponent; ++i) {
-    result *= *this;
-  }
+  forEachBit(exponent.slices, [&result, &base](bool bit, bool isLastBit) {
+    if (bit) result *= base;
+    if (!isLastBit) base *= base;
+  });
+
+  return result;
+}
+
+Integer Integer::powMod(const Integer &exponent, const Integer &modulus) const {
+  ensure(modulus != 0);                // modulo zero is undefined
+  ensure(*this != 0 || exponent != 0); // zero ^ zero is undefined
+  ensure(exponent.positive());         // Haven't implemented this yet
+
+  const auto absoluteModulus = modulus.absolute();
+
+  // Same as power, but reducing after every step so nothing grows past modulus ^ 2
+  Integer result = Integer{1} % absoluteModulus;
+  Integer base = *this % absoluteModulus;
+  if (!base.positive()) base += absoluteModulus;
+
+  forEachBit(exponent.slices, [&result, &base, &absoluteModulus](bool bit, bool isLastBit) {
+    if (bit) result = (result * base) % absoluteModulus;
+    if (!isLastBit) base = (base * base) % absoluteModulus;
+  });
 
   return result;
 }
 
+bool Integer::testBit(size_t bit) const {
+  const auto index = bit / SLICE_BITS;
+  const auto magnitudeBit = index < slices.size() && ((slices[index] >> (bit % SLICE_BITS)) & 1) != 0;
+  if (_positive) return magnitudeBit;
+
+  // In ~(m - 1), the bits below m's lowest set one stay zero, that one stays set, and every other one gets flipped
+  size_t lowestSetBit = 0;
+  for (auto it = slices.begin(); *it == 0; ++it) {
+    lowestSetBit += SLICE_BITS;
+  }
+  lowestSetBit += static_cast<size_t>(std::countr_zero(slices[lowestSetBit / SLICE_BITS]));
+
+  return bit <= lowestSetBit ? bit == lowestSetBit : !magnitudeBit;
+}
+
+Integer &Integer::operator<<=(size_t bits) {
+  if (slices.empty()) return *this;
+
+  const auto offset = bits / SLICE_BITS;
+  const auto shift = static_cast<int>(bits % SLICE_BITS);
+  const auto size = slices.size();
+
+  slices.resize(size + offset + 1);
+  auto data = slices.data();
+  data[size + offset] = 0;
+  if (shift == 0) {
+    std::copy_backward(data, data + size, data + size + offset);
+  } else {
+    for (auto i = size; i > 0; --i) {
+      data[i + offset] |= data[i - 1] >> (SLICE_BITS - shift);
+      data[i - 1 + offset] = data[i - 1] << shift;
+    }
+  }
+  std::fill_n(data, offset, 0);
+
+  slices.resize(significantSlices(data, slices.size()));
+  return *this;
+}
+
+Integer &Integer::operator>>=(size_t bits) {
+  const auto offset = bits / SLICE_BITS;
+  if (offset >= slices.size()) {
+    *this = Integer{0};
+    return *this;
+  }
+
+  const auto size = slices.size() - offset;
+  auto data = slices.data();
+  std::copy(data + offset, data + slices.size(), data);
+  slices.resize(size);
+  shiftSlicesRight(&slices, static_cast<int>(bits % SLICE_BITS));
+
+  _positive = _positive || slices.empty();
+  return *this;
+}
+
+Integer Integer::bitwise(const Integer &o, value_t (*operation)(value_t, value_t)) const {
+  const auto size = std::max(slices.size(), o.slices.size()) + 1;
+  auto result = twosComplement(slices, _positive, size);
+  const auto other = twosComplement(o.slices, o._positive, size);
+  for (size_t i = 0; i < size; ++i) {
+    result[i] = operation(result[i], other[i]);
+  }
+
+  auto positive = fromTwosComplement(&result);
+  return Integer{std::move(result), positive};
+}
+
+Integer Integer::operator&(const Integer &o) const {
+  return bitwise(o, [](value_t left, value_t right) -> value_t { return left & right; });
+}
+
+Integer Integer::operator|(const Integer &o) const {
+  return bitwise(o, [](value_t left, value_t right) -> value_t { return left | right; });
+}
+
+Integer Integer::operator^(const Integer &o) const {
+  return bitwise(o, [](value_t left, value_t right) -> value_t { return left ^ right; });
+}
+
+void Integer::addInPlace(const slices_t &other, bool otherPositive) {
+  if (&other == &slices) {
+    // Growing our storage would pull the rug from under other, so we need a copy
+    slices_t copy{other};
+    addInPlace(copy, otherPositive);
+    return;
+  }
+
+  if (other.empty()) return;
+  if (slices.empty()) {
+    slices = other;
+    _positive = otherPositive;
+    return;
+  }
+
+  if (_positive == otherPositive) {
+    slices.resize(std::max(slices.size(), other.size()));
+    if (addSlicesWithCarry(slices.data(), slices.size(), other.data(), other.size())) {
+      slices.push_back(1);
+    }
+  } else if (compareSlices(slices, other) != compat::strong_ordering::less) {
+    subtractSlicesFrom(slices.data(), slices.size(), other.data(), other.size());
+  } else {
+    // The other one is bigger, so we calculate other - this, and keep its sign
+    slices.resize(other.size());
+    uint64_t borrow = 0;
+    for (size_t i = 0; i < slices.size(); ++i) {
+      uint64_t difference = static_cast<uint64_t>(other[i]) - slices[i] - borrow;
+      slices[i] = static_cast<value_t>(difference);
+      borrow = (difference >> SLICE_BITS) & 1;
+    }
+    ensure(borrow == 0);
+    _positive = otherPositive;
+  }
+
+  slices.resize(significantSlices(slices.data(), slices.size()));
+  _positive = _positive || slices.empty();
+}
+
+Integer &Integer::operator+=(intmax_t value) {
+  auto sameSign = (value >= 0 && this->positive()) || (value < 0 && !this->positive());
+  auto absValue = magnitudeOf(value);
+  if (sameSign && !slices.empty() && absValue <= SLICE_MAX - slices[0]) {
+    // Optimizing this common scenario
+    slices[0] += static_cast<value_t>(absValue);
+    return *this;
+  }
+
+  Integer other{value};
+  addInPlace(other.slices, other._positive);
+  return *this;
+}
+
+Integer &Integer::operator-=(intmax_t value) {
+  Integer other{value};
+  addInPlace(other.slices, !other._positive);
+  return *this;
+}
+
+Integer &Integer::operator*=(intmax_t value) {
+  auto absValue = magnitudeOf(value);
+  if (absValue > SLICE_MAX) {
+    return *this = *this * Integer{value};
+  }
+
+  if (absValue == 0 || slices.empty()) {
+    slices.clear();
+    _positive = true;
+    return *this;
+  }
+
+  multiplyAddSlice(&slices, static_cast<value_t>(absValue), 0);
+  if (value < 0) _positive = !_positive;
+  return *this;
+}
+
 bool Integer::operator<(const Integer &o) const {
   if (this->positive() != o.positive()) {
     return this->positive() < o.positive();
@@ -409,16 +1397,179 @@ Integer &Integer::operator++() {
   }
 
   auto it = slices.begin();
-  while (it != slices.end()) {
-    if (*it == 0) {
-      *it = SLICE_MAX;
-      ++it;
+  while (*it == 0) {
+    *it = SLICE_MAX;
+    ++it;
+  }
+  --(*it);
+
+  if (slices.back() == 0) slices.pop_back();
+  return *this;
+}
+
+Integer pzl::greatestCommonDivisor(Integer left, Integer right) {
+  auto &bigger = left.slices, &smaller = right.slices;
+  if (compareSlices(bigger, smaller) == compat::strong_ordering::less) {
+    std::swap(bigger, smaller);
+  }
+
+  // This is Lehmer's algorithm (TAOCP Vol. 2, 4.5.2): Euclid runs on the leading 62 bits only, tracking its steps as
+  // cofactors, which then get applied to the whole numbers at once. Keeping these below 2^62 means nothing overflows
+  constexpr size_t leadingBits = 62;
+  while (smaller.size() > 2) {
+    const auto offset = bitLength(bigger) - leadingBits;
+    auto x = static_cast<int64_t>(bitsAt(bigger, offset));
+    auto y = static_cast<int64_t>(bitsAt(smaller, offset));
+
+    int64_t a = 1, b = 0, c = 0, d = 1;
+    while (y + c != 0 && y + d != 0) {
+      auto quotient = (x + a) / (y + c);
+      if (quotient != (x + b) / (y + d)) break;
+
+      std::tie(a, c) = std::make_pair(c, a - quotient * c);
+      std::tie(b, d) = std::make_pair(d, b - quotient * d);
+      std::tie(x, y) = std::make_pair(y, x - quotient * y);
+    }
+
+    if (b == 0) {
+      // The leading bits weren't enough to agree on a single quotient, so we need a whole division step
+      auto remainder = Integer{std::move(bigger), true}.divmod(Integer{smaller, true}).second;
+      bigger = std::move(smaller);
+      smaller = std::move(remainder.slices);
     } else {
-      --(*it);
-      return *this;
+      auto nextSmaller = linearCombination(bigger, c, smaller, d);
+      bigger = linearCombination(bigger, a, smaller, b);
+      smaller = std::move(nextSmaller);
     }
   }
 
-  slices.pop_back();
-  return *this;
+  // Now the smaller one fits in a machine word, and after one more step so does the bigger one
+  if (smaller.empty()) return Integer{std::move(bigger), true};
+
+  auto smallerWord = wordOf(smaller);
+  auto remainderWord = wordOf(Integer{std::move(bigger), true}.divmod(Integer{smaller, true}).second.slices);
+  auto gcd = std::gcd(smallerWord, remainderWord);
+
+  Integer::slices_t result;
+  for (; gcd > 0; gcd >>= SLICE_BITS) {
+    result.push_back(static_cast<Integer::value_t>(gcd));
+  }
+  return Integer{std::move(result), true};
+}
+
+// Whether root ^ k <= value, without overflowing
+inline bool rootFits(uint64_t root, size_t k, uint64_t value) {
+  unsigned __int128 power = 1;
+  for (size_t i = 0; i < k; ++i) {
+    power *= root;
+    if (power > value) return false;
+  }
+  return true;
+}
+
+Integer pzl::iroot(const Integer &value, size_t k) {
+  ensure(k > 0);
+  ensure(value.positive()); // Haven't implemented this yet
+  if (k == 1) return value;
+
+  const auto bits = value.bitLength();
+  if (bits <= 64) {
+    // Doubles get within a unit or two of the root, and then we make sure
+    auto word = wordOf(value.slices);
+    auto root = static_cast<uint64_t>(std::pow(static_cast<double>(word), 1.0 / static_cast<double>(k)));
+    while (root > 0 && !rootFits(root, k, word)) {
+      --root;
+    }
+    while (rootFits(root + 1, k, word)) {
+      ++root;
+    }
+    return Integer{static_cast<intmax_t>(root)};
+  }
+
+  // 2^k is already too big, so there's nothing left but 1
+  if (bits <= k) return Integer{1};
+
+  // The root of the top bits has about half of the bits of the whole root, so from that estimate a single step of
+  // Newton's method gets all but the last few units. Starting above the root, Newton's method never undershoots it, so
+  // we only ever need to step down, which is cheaper than another division. Roots with only a couple of bits still
+  // need to shift something off, or we'd be estimating from the very same value forever
+  const auto shift = std::max<size_t>(bits / (k * 2), 1);
+  auto estimate = (iroot(value >> (shift * k), k) + 1) << shift;
+
+  const Integer integerK{static_cast<intmax_t>(k)};
+  auto root = (estimate * static_cast<intmax_t>(k - 1) + value / estimate.power(integerK - 1)) / integerK;
+  while (root.power(integerK) > value) {
+    root -= 1;
+  }
+  return root;
+}
+
+template <size_t Modulus>
+constexpr std::array<bool, Modulus> squaresModulo() {
+  std::array<bool, Modulus> squares{};
+  for (size_t i = 0; i < Modulus; ++i) {
+    squares[i * i % Modulus] = true;
+  }
+  return squares;
+}
+
+bool pzl::isPerfectSquare(const Integer &value) {
+  if (!value.positive()) return false;
+
+  // Only about 1 in 120 numbers have residues modulo 64, 63, 65 and 11 that squares can have, and we get all of them
+  // from a single division by their product
+  constexpr auto squaresModulo64 = squaresModulo<64>();
+  constexpr auto squaresModulo63 = squaresModulo<63>();
+  constexpr auto squaresModulo65 = squaresModulo<65>();
+  constexpr auto squaresModulo11 = squaresModulo<11>();
+
+  const auto residue = wordOf((value % Integer{64 * 63 * 65 * 11}).slices);
+  if (!squaresModulo64[residue % 64] || !squaresModulo63[residue % 63] || !squaresModulo65[residue % 65] ||
+      !squaresModulo11[residue % 11]) {
+    return false;
+  }
+
+  auto root = isqrt(value);
+  return root * root == value;
+}
+
+bool pzl::isProbablePrime(const Integer &value, size_t rounds) {
+  if (value < 2) return false;
+
+  // A single division tells us whether it has any small factors
+  constexpr std::array<intmax_t, 15> smallPrimes{2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47};
+  constexpr auto smallPrimesProduct = intmax_t{2} * 3 * 5 * 7 * 11 * 13 * 17 * 19 * 23 * 29 * 31 * 37 * 41 * 43 * 47;
+  const auto residue = *(value % Integer{smallPrimesProduct}).toIntmax();
+  for (auto prime : smallPrimes) {
+    if (residue % prime == 0) return value == prime;
+  }
+  if (value < 47 * 47) return true;
+
+  // value - 1 = d * 2^s, with d odd
+  const auto minusOne = value - 1;
+  size_t s = 1;
+  while (!minusOne.testBit(s)) ++s;
+  const auto d = minusOne >> s;
+
+  auto isWitness = [&value, &minusOne, s, &d](const Integer &base) {
+    auto x = base.powMod(d, value);
+    if (x == 1 || x == minusOne) return false;
+    for (size_t i = 1; i < s; ++i) {
+      x = x * x % value;
+      if (x == minusOne) return false;
+    }
+    return true;
+  };
+
+  // The primes up to 41 as bases are enough for anything below 3.3 * 10^24, and random ones do the rest
+  for (size_t i = 0; i < 13; ++i) {
+    if (isWitness(Integer{smallPrimes[i]})) return false;
+  }
+  std::mt19937_64 random{value.bitLength()};
+  const auto range = value - 3;
+  for (size_t i = 0; i < rounds; ++i) {
+    if (isWitness(Integer{static_cast<intmax_t>(random() >> 1)} % range + 2)) return false;
+  }
+
+  return true;
 }
@@ -22,36 +22,79 @@
 
 #pragma once
 
+#include "common/small_vector.h"
 #include "compat/defs.h"
 
-#include <cstdint> // uint32_t, intmax_t
-#include <string>  // std::string
-#include <vector>  // std::vector
+#include <cstddef>  // size_t
+#include <cstdint>  // uint32_t, intmax_t
+#include <optional> // std::optional
+#include <string>   // std::string
+#include <utility>  // std::pair
 
 namespace pzl {
 
 struct Integer {
 
   using value_t = uint32_t;
+  // Four base-2^32 slices hold any product of two 64-bit values, so those never need the heap
+  using slices_t = pzl::SmallVector<value_t, 4>;
+
+  // Multiplying operands with fewer slices than this uses the schoolbook algorithm instead of Karatsuba's
+  static inline size_t karatsubaThreshold = 32;
+  // Multiplying operands with at least this many slices uses Toom-3 instead of Karatsuba
+  static inline size_t toomCookThreshold = 512;
+  // Multiplying operands with at least this many slices uses number theoretic transforms instead of Toom-3
+  static inline size_t nttThreshold = 10240;
+  // Dividing when both the divisor and the quotient have at least this many slices uses Newton's reciprocals instead
+  // of long division
+  static inline size_t newtonDivisionThreshold = 768;
 
   explicit Integer(const std::string &);
   explicit Integer(intmax_t value);
 
   [[nodiscard]] inline Integer absolute() const { return Integer{slices, true}; }
   [[nodiscard]] inline bool positive() const { return _positive; }
+  // How many bits the absolute value needs, zero needs none
+  [[nodiscard]] size_t bitLength() const;
   [[nodiscard]] std::string toString() const;
+  // Nothing if it doesn't fit
+  [[nodiscard]] std::optional<intmax_t> toIntmax() const;
 
-  [[nodiscard]] Integer operator+(const Integer &) const;
-  [[nodiscard]] Integer operator-(const Integer &) const;
+  [[nodiscard]] Integer operator+(const Integer &) const &;
+  [[nodiscard]] Integer operator-(const Integer &) const &;
   [[nodiscard]] Integer operator*(const Integer &) const;
-  [[nodiscard]] Integer operator/(const Integer &) const;
-  [[nodiscard]] Integer operator%(const Integer &) const;
-
-  [[nodiscard]] Integer operator+(intmax_t) const;
-  [[nodiscard]] inline Integer operator-(intmax_t o) const { return *this + -o; }
-  [[nodiscard]] Integer operator*(intmax_t) const;
+  [[nodiscard]] inline Integer operator/(const Integer &o) const { return divmod(o).first; }
+  [[nodiscard]] inline Integer operator%(const Integer &o) const { return divmod(o).second; }
+
+  // Truncated division, returns both the quotient and the remainder, which always has the same sign as *this
+  [[nodiscard]] std::pair<Integer, Integer> divmod(const Integer &) const;
+
+  [[nodiscard]] Integer operator+(intmax_t) const &;
+  [[nodiscard]] inline Integer operator-(intmax_t o) const & { return *this + -o; }
+  [[nodiscard]] Integer operator*(intmax_t) const &;
+
+  // Temporaries get their storage reused instead of copied
+  [[nodiscard]] inline Integer operator+(const Integer &o) && { return std::move(*this += o); }
+  [[nodiscard]] inline Integer operator-(const Integer &o) && { return std::move(*this -= o); }
+  [[nodiscard]] inline Integer operator+(intmax_t o) && { return std::move(*this += o); }
+  [[nodiscard]] inline Integer operator-(intmax_t o) && { return std::move(*this -= o); }
+  [[nodiscard]] inline Integer operator*(intmax_t o) && { return std::move(*this *= o); }
+
+  // Shifting right truncates towards zero, like dividing by a power of two
+  [[nodiscard]] inline Integer operator<<(size_t bits) const & { return Integer{*this} <<= bits; }
+  [[nodiscard]] inline Integer operator>>(size_t bits) const & { return Integer{*this} >>= bits; }
+  [[nodiscard]] inline Integer operator<<(size_t bits) && { return std::move(*this <<= bits); }
+  [[nodiscard]] inline Integer operator>>(size_t bits) && { return std::move(*this >>= bits); }
+
+  // Bitwise operations and testBit treat negative values as if they were in an infinitely wide two's complement
+  [[nodiscard]] Integer operator&(const Integer &) const;
+  [[nodiscard]] Integer operator|(const Integer &) const;
+  [[nodiscard]] Integer operator^(const Integer &) const;
+  [[nodiscard]] bool testBit(size_t bit) const;
 
   [[nodiscard]] Integer power(const Integer &) const;
+  // (*this ^ exponent) % modulus, always in the [0, |modulus|) range
+  [[nodiscard]] Integer powMod(const Integer &exponent, const Integer &modulus) const;
 
 #ifdef __cpp_lib_three_way_comparison
   [[nodiscard]] inline bool operator==(const Integer &) const = default;
@@ -76,21 +119,42 @@ struct Integer {
   [[nodiscard]] inline bool operator<=(intmax_t o) const { return *this <= Integer{o}; }
   [[nodiscard]] inline bool operator>(intmax_t o) const { return *this > Integer{o}; }
 
+  // These work in place, only reaching for the heap when the result outgrows the current storage
   Integer &operator++();
-  inline void operator+=(const Integer &o) { *this = *this + o; }
-  inline void operator-=(const Integer &o) { *this = *this - o; }
-  inline void operator*=(const Integer &o) { *this = *this * o; }
-  inline void operator/=(const Integer &o) { *this = *this / o; }
-  inline void operator%=(const Integer &o) { *this = *this % o; }
-
-  inline void operator-=(intmax_t &o) { *this = *this - o; }
-  inline void operator*=(intmax_t o) { *this = *this * o; }
+  inline Integer &operator+=(const Integer &o) {
+    addInPlace(o.slices, o._positive);
+    return *this;
+  }
+  inline Integer &operator-=(const Integer &o) {
+    addInPlace(o.slices, !o._positive);
+    return *this;
+  }
+  Integer &operator+=(intmax_t);
+  Integer &operator-=(intmax_t);
+  Integer &operator*=(intmax_t);
+  Integer &operator<<=(size_t bits);
+  Integer &operator>>=(size_t bits);
+
+  // These need a separate buffer for the result anyway
+  inline Integer &operator*=(const Integer &o) { return *this = *this * o; }
+  inline Integer &operator/=(const Integer &o) { return *this = *this / o; }
+  inline Integer &operator%=(const Integer &o) { return *this = *this % o; }
+  inline Integer &operator&=(const Integer &o) { return *this = *this & o; }
+  inline Integer &operator|=(const Integer &o) { return *this = *this | o; }
+  inline Integer &operator^=(const Integer &o) { return *this = *this ^ o; }
 
 private:
-  Integer(std::vector<value_t> slices, bool positive)
+  Integer(slices_t slices, bool positive)
       : slices(std::move(slices)), _positive(positive || this->slices.empty()) {}
 
-  std::vector<value_t> slices; // Low-endian base-10 storage
+  void addInPlace(const slices_t &, bool positive);
+  [[nodiscard]] Integer bitwise(const Integer &, value_t (*operation)(value_t, value_t)) const;
+
+  friend Integer greatestCommonDivisor(Integer, Integer);
+  friend Integer iroot(const Integer &, size_t);
+  friend bool isPerfectSquare(const Integer &);
+
+  slices_t slices; // Little-endian base-2^32 storage
   bool _positive;
 };
 }
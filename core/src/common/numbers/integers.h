@@ -23,43 +23,39 @@
 #pragma once
 
 #include "common/assertions.h"
+#include "common/numbers/fixed_integer.h"
 #include "common/numbers/integer.h"
 
 namespace pzl {
 
-inline Integer greatestCommonDivisor(Integer left, Integer right) {
-  // This is the Euclidean algorithm
-  if (left == 0) return right;
+// Always positive, unless both are zero
+Integer greatestCommonDivisor(Integer left, Integer right);
 
-  left = left.absolute();
-  right = right.absolute();
+// floor(value ^ (1 / k)), for non-negative values
+Integer iroot(const Integer &value, size_t k);
 
-  while (true) {
-    if (right == 0) return left;
-    left %= right;
-    if (left == 0) return right;
-    right %= left;
-  }
+inline Integer isqrt(const Integer &value) {
+  return iroot(value, 2);
 }
 
-inline Integer lowestCommonMultiple(const Integer &lhs, const Integer &rhs) {
+bool isPerfectSquare(const Integer &value);
+
+// Miller-Rabin, which is always right below 3.3 * 10^24, and past that only calls a composite prime with a probability
+// of around 4^-rounds
+bool isProbablePrime(const Integer &value, size_t rounds = 16);
+
+// These work with both Integer and FixedInteger
+
+template <typename Number>
+inline Number lowestCommonMultiple(const Number &lhs, const Number &rhs) {
   ensure(lhs != 0 && rhs != 0); // This is undefined
   auto gcd = greatestCommonDivisor(lhs, rhs);
-  return lhs * rhs / gcd;
+  return lhs / gcd * rhs;
 }
 
-inline Integer greatestPowerOfTwo(const Integer &integer) {
+template <typename Number>
+inline Number greatestPowerOfTwo(const Number &integer) {
   ensure(integer > 0);
-
-  if (integer == 1 || integer == 2) return integer;
-
-  Integer candidate{1};
-  Integer next{2};
-  while (integer >= next) {
-    candidate = next;
-    next = next * 2;
-  }
-
-  return candidate;
+  return Number{1} << (integer.bitLength() - 1);
 }
 }
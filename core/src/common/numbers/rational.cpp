@@ -25,99 +25,391 @@
 #include "common/assertions.h"
 #include "common/numbers/integers.h" // greatestCommonDivisor
 
-#include <algorithm> // std::find
+#include <algorithm> // std::max
+#include <cstdint>   // UINTMAX_MAX
+#include <numeric>   // std::gcd
+#include <optional>  // std::optional
+#include <string>    // std::string, std::to_string
+#include <utility>   // std::move, std::pair
 
 using pzl::Integer;
 using pzl::Rational;
 
-Rational::Rational(intmax_t numerator, intmax_t denominator)
-    : numerator{numerator}, denominator{std::abs(denominator)} {
-  ensure(denominator != 0);
-  if (denominator < 0) {
-    this->numerator *= -1;
+namespace {
+
+// Machine word arithmetic on simplified fractions, returning nothing if anything overflows. None of these ever return
+// INTMAX_MIN, so negating their results is always safe
+struct SmallFraction {
+  intmax_t numerator;
+  intmax_t denominator;
+};
+
+inline bool fitsSmall(intmax_t value) {
+  return value != INTMAX_MIN;
+}
+
+inline intmax_t gcdOf(intmax_t left, intmax_t right) {
+  auto magnitude = static_cast<uintmax_t>(left < 0 ? -left : left);
+  return static_cast<intmax_t>(std::gcd(magnitude, static_cast<uintmax_t>(right)));
+}
+
+std::optional<SmallFraction> addSmall(SmallFraction left, SmallFraction right) {
+  // This is from TAOCP Vol. 2, 4.5.1: with g = gcd(b, d), the only factors a/b + c/d can still simplify by are g's
+  auto g = gcdOf(left.denominator, right.denominator);
+
+  intmax_t leftTerm, rightTerm, sum;
+  if (__builtin_mul_overflow(left.numerator, right.denominator / g, &leftTerm) ||
+      __builtin_mul_overflow(right.numerator, left.denominator / g, &rightTerm) ||
+      __builtin_add_overflow(leftTerm, rightTerm, &sum) || !fitsSmall(sum)) {
+    return std::nullopt;
   }
-  this->simplify();
+  if (sum == 0) return SmallFraction{0, 1};
+
+  auto common = g == 1 ? 1 : gcdOf(sum, g);
+  intmax_t denominator;
+  if (__builtin_mul_overflow(left.denominator / g, right.denominator / common, &denominator)) return std::nullopt;
+  return SmallFraction{sum / common, denominator};
+}
+
+std::optional<SmallFraction> multiplySmall(SmallFraction left, SmallFraction right) {
+  if (left.numerator == 0 || right.numerator == 0) return SmallFraction{0, 1};
+
+  // Cancelling across first, since a/b and c/d are already simplified, leaves the product simplified too
+  auto leftGcd = gcdOf(left.numerator, right.denominator);
+  auto rightGcd = gcdOf(right.numerator, left.denominator);
+
+  intmax_t numerator, denominator;
+  if (__builtin_mul_overflow(left.numerator / leftGcd, right.numerator / rightGcd, &numerator) ||
+      __builtin_mul_overflow(left.denominator / rightGcd, right.denominator / leftGcd, &denominator) ||
+      !fitsSmall(numerator)) {
+    return std::nullopt;
+  }
+  return SmallFraction{numerator, denominator};
+}
+
+std::optional<SmallFraction> powerSmall(SmallFraction base, intmax_t exponent) {
+  SmallFraction result{1, 1};
+  for (; exponent > 0; exponent >>= 1) {
+    if ((exponent & 1) != 0) {
+      if (__builtin_mul_overflow(result.numerator, base.numerator, &result.numerator) ||
+          __builtin_mul_overflow(result.denominator, base.denominator, &result.denominator) ||
+          !fitsSmall(result.numerator)) {
+        return std::nullopt;
+      }
+    }
+    if (exponent > 1 && (__builtin_mul_overflow(base.numerator, base.numerator, &base.numerator) ||
+                         __builtin_mul_overflow(base.denominator, base.denominator, &base.denominator))) {
+      return std::nullopt;
+    }
+  }
+  return result;
+}
+
+constexpr auto decimalBase = 10; // TODO: Other bases?
+
+inline uintmax_t absoluteValue(intmax_t value) {
+  return static_cast<uintmax_t>(value < 0 ? -value : value);
+}
+
+// Long division only needs the remainder times the base to fit
+inline bool fitsDecimalStep(intmax_t denominator) {
+  return static_cast<uintmax_t>(denominator) <= UINTMAX_MAX / decimalBase;
+}
+
+inline uint8_t nextDecimalDigit(uintmax_t *remainder, uintmax_t denominator) {
+  *remainder *= decimalBase;
+  auto digit = *remainder / denominator;
+  *remainder %= denominator;
+  return static_cast<uint8_t>(digit);
+}
+
+inline uint8_t nextDecimalDigit(Integer *remainder, const Integer &denominator) {
+  auto [digit, next] = (*remainder * decimalBase).divmod(denominator);
+  *remainder = std::move(next);
+  return static_cast<uint8_t>(digit.toIntmax().value_or(0));
+}
+
+#if defined(__cpp_impl_coroutine)
+
+// The remainder and denominator get copied into the coroutine, so this can outlive the Rational it came from
+template <typename T>
+Puzzles::LazySequence<uint8_t> decimalDigitsOf(T remainder, T denominator) {
+  for (;;) {
+    co_yield nextDecimalDigit(&remainder, denominator);
+  }
+}
+
+#endif // defined(__cpp_impl_coroutine)
+
+template <typename T>
+struct Cycle {
+  T entry;       // The first value that comes back around
+  size_t offset; // How many steps it takes to get to entry
+  size_t length; // How many steps it takes for entry to come back
+};
+
+// Brent's cycle detection on start, step(start), step(step(start)) and so on. It only keeps two values at a time, and
+// moves the slower one up to the faster one at powers of two, which takes fewer steps than Floyd's tortoise and hare
+template <typename T, typename Step>
+Cycle<T> findCycle(const T &start, const Step &step) {
+  size_t power = 1, length = 1;
+  T tortoise = start;
+  T hare = step(start);
+  while (tortoise != hare) {
+    if (power == length) {
+      tortoise = hare;
+      power *= 2;
+      length = 0;
+    }
+    hare = step(hare);
+    ++length;
+  }
+
+  // Now the hare starts length steps ahead, so they'll meet exactly at the start of the cycle
+  tortoise = start;
+  hare = start;
+  for (size_t i = 0; i < length; ++i) {
+    hare = step(hare);
+  }
+  size_t offset = 0;
+  while (tortoise != hare) {
+    tortoise = step(tortoise);
+    hare = step(hare);
+    ++offset;
+  }
+
+  return Cycle<T>{std::move(tortoise), offset, length};
+}
 }
 
-Rational::Rational(Integer numerator, const Integer &denominator)
-    : numerator{std::move(numerator)}, denominator{std::abs(denominator)} {
+Rational::Rational(intmax_t numerator, intmax_t denominator) {
   ensure(denominator != 0);
-  if (denominator < 0) {
+
+  if (fitsSmall(numerator) && fitsSmall(denominator)) {
+    auto gcd = gcdOf(numerator, denominator < 0 ? -denominator : denominator);
+    auto sign = denominator < 0 ? -1 : 1;
+    *this = small(sign * numerator / gcd, sign * denominator / gcd, false, 0);
+    return;
+  }
+
+  *this = Rational{Integer{numerator}, Integer{denominator}};
+}
+
+Rational::Rational(Integer numerator, Integer denominator)
+    : numerator{std::move(numerator)}, denominator{std::move(denominator)} {
+  ensure(this->denominator != 0);
+  if (this->denominator < 0) {
     this->numerator *= -1;
+    this->denominator *= -1;
   }
   this->simplify();
 }
 
+Rational::Rational(Integer numerator, Integer denominator, bool lazy, size_t lazyLimit)
+    : numerator{std::move(numerator)}, denominator{std::move(denominator)}, _lazy{lazy}, _lazyLimit{lazyLimit} {
+  ensure(this->denominator > 0);
+  if (!lazy) {
+    this->simplify();
+  } else if (std::max(this->numerator.bitLength(), this->denominator.bitLength()) > lazyLimit) {
+    this->simplify();
+    auto bitLength = std::max(this->numerator.bitLength(), this->denominator.bitLength());
+    this->_lazyLimit = std::max(lazyThreshold, bitLength * 2);
+  }
+}
+
+Rational Rational::small(intmax_t numerator, intmax_t denominator, bool lazy, size_t lazyLimit) {
+  ensure(denominator > 0 && fitsSmall(numerator));
+
+  Rational result;
+  result._lazy = lazy;
+  result._lazyLimit = lazyLimit;
+  result._small = true;
+  result.smallNumerator = numerator;
+  result.smallDenominator = denominator;
+  return result;
+}
+
+Rational Rational::big() const {
+  if (!_small) return *this;
+
+  Rational result;
+  result.numerator = Integer{smallNumerator};
+  result.denominator = Integer{smallDenominator};
+  result._lazy = _lazy;
+  result._lazyLimit = _lazyLimit;
+  return result;
+}
+
+void Rational::demote() {
+  if (_small) return;
+
+  auto smallNumerator = numerator.toIntmax();
+  auto smallDenominator = denominator.toIntmax();
+  if (!smallNumerator || !smallDenominator || !fitsSmall(*smallNumerator)) return;
+
+  *this = small(*smallNumerator, *smallDenominator, _lazy, _lazyLimit);
+}
+
+Rational Rational::lazy() const {
+  Rational result{*this};
+  if (!result._lazy) {
+    result._lazy = true;
+    result._lazyLimit = _small ? lazyThreshold
+                               : std::max(lazyThreshold, std::max(numerator.bitLength(), denominator.bitLength()) * 2);
+  }
+  return result;
+}
+
+Rational Rational::eager() const {
+  Rational result{*this};
+  if (result._lazy) {
+    result.simplify();
+    result._lazy = false;
+    result._lazyLimit = 0;
+  }
+  return result;
+}
+
 Rational Rational::operator+(const Rational &o) const {
+  if (this->_small && o._small) {
+    auto sum = addSmall({smallNumerator, smallDenominator}, {o.smallNumerator, o.smallDenominator});
+    if (sum) return small(sum->numerator, sum->denominator, _lazy || o._lazy, std::max(_lazyLimit, o._lazyLimit));
+  }
+  if (this->_small || o._small) return this->big() + o.big();
+
+  if (this->_lazy || o._lazy) {
+    auto lazyLimit = std::max(this->_lazyLimit, o._lazyLimit);
+    if (this->denominator == o.denominator) {
+      return Rational{this->numerator + o.numerator, this->denominator, true, lazyLimit};
+    }
+    return Rational{this->numerator * o.denominator + o.numerator * this->denominator,
+                    this->denominator * o.denominator, true, lazyLimit};
+  }
+
   auto [left, right, denominator] = normalizeDenominatorWith(o);
-  return Rational(left + right, denominator).simplify();
+  return Rational(std::move(left) + right, std::move(denominator));
 }
 
 Rational Rational::operator-(const Rational &o) const {
+  if (this->_small && o._small) {
+    auto difference = addSmall({smallNumerator, smallDenominator}, {-o.smallNumerator, o.smallDenominator});
+    if (difference) {
+      auto lazyLimit = std::max(_lazyLimit, o._lazyLimit);
+      return small(difference->numerator, difference->denominator, _lazy || o._lazy, lazyLimit);
+    }
+  }
+  if (this->_small || o._small) return this->big() - o.big();
+
+  if (this->_lazy || o._lazy) {
+    auto lazyLimit = std::max(this->_lazyLimit, o._lazyLimit);
+    if (this->denominator == o.denominator) {
+      return Rational{this->numerator - o.numerator, this->denominator, true, lazyLimit};
+    }
+    return Rational{this->numerator * o.denominator - o.numerator * this->denominator,
+                    this->denominator * o.denominator, true, lazyLimit};
+  }
+
   auto [left, right, denominator] = normalizeDenominatorWith(o);
-  return Rational(left - right, denominator).simplify();
+  return Rational(std::move(left) - right, std::move(denominator));
 }
 
 Rational Rational::operator*(const Rational &o) const {
-  auto num = this->numerator * o.numerator;
-  auto den = this->denominator * o.denominator;
+  if (this->_small && o._small) {
+    auto product = multiplySmall({smallNumerator, smallDenominator}, {o.smallNumerator, o.smallDenominator});
+    if (product) {
+      return small(product->numerator, product->denominator, _lazy || o._lazy, std::max(_lazyLimit, o._lazyLimit));
+    }
+  }
+  if (this->_small || o._small) return this->big() * o.big();
 
-  return Rational(num, den).simplify();
+  return Rational{this->numerator * o.numerator, this->denominator * o.denominator, this->_lazy || o._lazy,
+                  std::max(this->_lazyLimit, o._lazyLimit)};
 }
 
 Rational Rational::operator/(const Rational &o) const {
   ensure(o != 0); // division by zero is undefined
-  if (numerator == 0) {
+  if (*this == 0) {
     return Rational(0);
   }
 
-  ensure(this->denominator == 1 && o.denominator == 1); // Haven't implemented this yet
+  if (this->_small && o._small) {
+    // The reciprocal of a simplified fraction is simplified too, it only needs the sign moved to the numerator
+    auto sign = o.smallNumerator < 0 ? -1 : 1;
+    auto reciprocal = SmallFraction{sign * o.smallDenominator, sign * o.smallNumerator};
+    auto quotient = multiplySmall({smallNumerator, smallDenominator}, reciprocal);
+    if (quotient) {
+      return small(quotient->numerator, quotient->denominator, _lazy || o._lazy, std::max(_lazyLimit, o._lazyLimit));
+    }
+  }
+  if (this->_small || o._small) return this->big() / o.big();
 
-  // Now for the actual implementation
-  Integer remainder = this->numerator.absolute();
-  Integer integer(0);
-  const auto step = o.numerator.absolute();
+  // We're multiplying by the reciprocal, so (a/b) / (c/d) = (a*d) / (b*c), keeping the sign in the numerator
+  const auto flip = !o.positive();
 
-  while (remainder >= step) {
-    remainder -= step;
-    ++integer;
+  if (this->_lazy || o._lazy) {
+    auto newNumerator = this->numerator * o.denominator;
+    auto newDenominator = this->denominator * o.numerator;
+    if (flip) {
+      newNumerator *= -1;
+      newDenominator *= -1;
+    }
+    return Rational{std::move(newNumerator), std::move(newDenominator), true, std::max(this->_lazyLimit, o._lazyLimit)};
   }
 
-  if (remainder == 0) {
-    if (positive() != o.positive()) {
-      integer *= -1;
-    }
-    return Rational(integer);
-  } else {
-    auto finalNumerator = (integer * step) + remainder;
-    if (positive() != o.positive()) {
-      finalNumerator *= -1;
-    }
-    return Rational{finalNumerator, step};
+  // Both are already simplified, so the only factors (a*d) and (b*c) can have in common are the ones from gcd(a, c) and
+  // gcd(b, d). Cancelling those first keeps the products small, and leaves nothing to simplify afterwards
+  auto numeratorGcd = greatestCommonDivisor(this->numerator, o.numerator);
+  auto denominatorGcd = greatestCommonDivisor(this->denominator, o.denominator);
+
+  Rational result;
+  result.numerator = (this->numerator / numeratorGcd) * (o.denominator / denominatorGcd);
+  result.denominator = (this->denominator / denominatorGcd) * (o.numerator / numeratorGcd);
+  if (flip) {
+    result.numerator *= -1;
+    result.denominator *= -1;
   }
+  result.demote();
+  return result;
 }
 
 Rational Rational::power(const Rational &exp) const {
   ensure(*this != 0 || exp != 0); // zero ^ zero is undefined
   ensure(exp.positive());         // Haven't implemented this yet
-  ensure(exp.denominator == 1);   // Haven't implemented this yet
 
-  // Integer power is faster than Rational power
-  if (this->denominator == 1) {
-    auto result = std::pow(this->numerator, exp.numerator);
-    return Rational(result, Integer(1));
-  }
+  if (exp._lazy) return this->power(exp.eager());
 
-  Rational result(1);
+  if (exp._small) {
+    ensure(exp.smallDenominator == 1); // Haven't implemented this yet
+    if (this->_small) {
+      auto result = powerSmall({smallNumerator, smallDenominator}, exp.smallNumerator);
+      if (result) return small(result->numerator, result->denominator, _lazy, _lazyLimit);
+    }
+    return this->big().power(exp.big());
+  }
+  if (this->_small) return this->big().power(exp);
+  ensure(exp.denominator == 1); // Haven't implemented this yet
 
-  for (Integer i{0}; i < exp.numerator; ++i) {
-    result *= *this;
+  if (this->_lazy) {
+    return Rational{std::pow(this->numerator, exp.numerator), std::pow(this->denominator, exp.numerator), true,
+                    this->_lazyLimit};
   }
 
+  // Since numerator and denominator are coprime, so are their powers, so there's nothing left to simplify
+  Rational result;
+  result.numerator = std::pow(this->numerator, exp.numerator);
+  result.denominator = std::pow(this->denominator, exp.numerator);
+  result.demote();
   return result;
 }
 
 bool Rational::operator<(const Rational &o) const {
+  if (this->_small && o._small) {
+    // Cross-multiplying machine words never overflows 128 bits
+    return static_cast<__int128>(smallNumerator) * o.smallDenominator <
+           static_cast<__int128>(o.smallNumerator) * smallDenominator;
+  }
+  if (this->_small || o._small) return this->big() < o.big();
+
   ensure(this->denominator > 0);
   ensure(o.denominator > 0);
 
@@ -125,21 +417,53 @@ bool Rational::operator<(const Rational &o) const {
     return o.positive();
   }
 
-  auto [us, them, _] = normalizeDenominatorWith(o);
-  UNUSED(_);
+  // From here on both have the same sign, so we compare their absolute values and flip the answer if they're negative
+  const auto flip = !this->positive();
+
+  if (this->numerator == 0 || o.numerator == 0) {
+    return flip ? this->numerator != 0 : o.numerator != 0;
+  }
 
-  return us < them;
+  // Since 2^(bits - 1) <= x < 2^bits, the absolute value of a/b is between 2^(a.bits - b.bits - 1) and
+  // 2^(a.bits - b.bits + 1), so if those ranges don't overlap we already know which one's bigger
+  auto magnitude = [](const Rational &value) {
+    return static_cast<intmax_t>(value.numerator.bitLength()) - static_cast<intmax_t>(value.denominator.bitLength());
+  };
+  auto ours = magnitude(*this), theirs = magnitude(o);
+  if (ours + 1 <= theirs - 1) return !flip;
+  if (theirs + 1 <= ours - 1) return flip;
+
+  // Too close to call, so we cross-multiply, which also works for unsimplified lazy Rationals
+  return this->numerator * o.denominator < o.numerator * this->denominator;
 }
 
 bool Rational::operator==(const Rational &o) const {
+  if (this->_small && o._small) {
+    return smallNumerator == o.smallNumerator && smallDenominator == o.smallDenominator;
+  }
+  // Simplified Rationals that fit are always small, so a small one can only equal a big one that's lazy
+  if (this->_small || o._small) return (this->_lazy || o._lazy) && this->big() == o.big();
+
   ensure(this->denominator > 0);
   ensure(o.denominator > 0);
 
+  if (this->_lazy || o._lazy) {
+    return this->numerator * o.denominator == o.numerator * this->denominator;
+  }
+
   return this->denominator == o.denominator && this->numerator == o.numerator;
 }
 
 std::string Rational::toString() const {
+  if (_small) {
+    auto result = std::to_string(smallNumerator);
+    if (smallDenominator != 1) result += "/" + std::to_string(smallDenominator);
+    return result;
+  }
+
   ensure(denominator > 0);
+  if (_lazy) return eager().toString();
+
   auto result = std::to_string(numerator);
 
   if (denominator != 1) {
@@ -150,72 +474,97 @@ std::string Rational::toString() const {
 }
 
 std::string Rational::toStringWithDecimalExpansion() const {
-  const auto base = 10; // TODO: Other bases?
-  ensure(denominator > 0);
+  if (_lazy) return eager().toStringWithDecimalExpansion();
+  if (_small ? smallDenominator == 1 : denominator == 1) return toString();
+
+  auto [offset, period] = decimalPeriod();
+  std::string result = positive() ? "" : "-";
+
+  auto appendDigits = [&result, offset, period](const auto &numerator, const auto &denominator) {
+    auto remainder = numerator % denominator;
+    result += std::to_string(numerator / denominator) + ".";
+    result.reserve(result.length() + offset + period + 2);
+    for (size_t i = 0; i < offset + period; ++i) {
+      if (i == offset) result += '(';
+      result += static_cast<char>('0' + nextDecimalDigit(&remainder, denominator));
+    }
+    if (period > 0) result += ')';
+  };
 
-  if (denominator == 1) {
-    return toString();
+  if (_small && fitsDecimalStep(smallDenominator)) {
+    appendDigits(absoluteValue(smallNumerator), static_cast<uintmax_t>(smallDenominator));
+  } else {
+    auto value = big();
+    appendDigits(value.numerator.absolute(), value.denominator);
   }
+  return result;
+}
 
-  // TODO: Create a function to have both / & % at the same time for performance
-  auto fractionalPart = numerator % denominator;
-  auto integerPart = (numerator - fractionalPart) / denominator;
+#if defined(__cpp_impl_coroutine)
 
-  auto result = integerPart.toString() + ".";
+Puzzles::LazySequence<uint8_t> Rational::decimalDigits() const {
+  if (_lazy) return eager().decimalDigits();
 
-  const auto periodIndex = result.length();
-  auto pastDivisions = std::vector<std::pair<Integer, Integer>>();
+  if (_small && fitsDecimalStep(smallDenominator)) {
+    return decimalDigitsOf(absoluteValue(smallNumerator) % static_cast<uintmax_t>(smallDenominator),
+                           static_cast<uintmax_t>(smallDenominator));
+  }
+  auto value = big();
+  return decimalDigitsOf(value.numerator.absolute() % value.denominator, value.denominator);
+}
 
-  while (fractionalPart != 0) {
-    auto dividend = fractionalPart * base;
-    fractionalPart = dividend % denominator;
-    auto nextDigit = (dividend - fractionalPart) / denominator;
-    ensure(nextDigit < base);
+#else // defined(__cpp_impl_coroutine)
 
-    auto divisionPair = std::make_pair(fractionalPart, nextDigit);
-    auto begin = pastDivisions.cbegin();
-    auto end = pastDivisions.cend();
-    auto it = std::find(begin, end, divisionPair);
-    if (it != end) {
-      // From here on out, we'll be repeating our digits
-      auto index = static_cast<size_t>(it - begin);
-      result = result.insert(periodIndex + index, "(");
-      result += ")";
-      break;
-    }
+Puzzles::LazySequence<uint8_t> Rational::decimalDigits() const {
+  return Puzzles::LazySequence<uint8_t>();
+}
+
+#endif // defined(__cpp_impl_coroutine)
+
+std::pair<size_t, size_t> Rational::decimalPeriod() const {
+  if (_lazy) return eager().decimalPeriod();
+
+  // Each remainder only depends on the one before, so once one repeats all of the digits after it do too. Terminating
+  // expansions end up stuck on a remainder of zero, which isn't much of a period
+  auto period = [](const auto &cycle) { return std::make_pair(cycle.offset, cycle.entry == 0 ? 0 : cycle.length); };
 
-    pastDivisions.push_back(divisionPair);
-    result += nextDigit.toString();
+  if (_small && fitsDecimalStep(smallDenominator)) {
+    auto denominator = static_cast<uintmax_t>(smallDenominator);
+    auto remainder = absoluteValue(smallNumerator) % denominator;
+    return period(findCycle(remainder, [denominator](uintmax_t value) { return value * decimalBase % denominator; }));
   }
 
-  return result;
+  auto value = big();
+  auto remainder = value.numerator.absolute() % value.denominator;
+  return period(
+      findCycle(remainder, [&value](const Integer &remainder) { return remainder * decimalBase % value.denominator; }));
 }
 
 std::tuple<Integer, Integer, Integer> Rational::normalizeDenominatorWith(const Rational &o) const {
   if (denominator == o.denominator) return std::make_tuple(this->numerator, o.numerator, this->denominator);
 
-  auto leftNumerator = this->numerator;
-  auto leftDenominator = this->denominator;
-  auto rightNumerator = o.numerator;
-  auto rightDenominator = o.denominator;
-
-  auto newDenominator = lowestCommonMultiple(leftDenominator, rightDenominator);
+  auto newDenominator = lowestCommonMultiple(this->denominator, o.denominator);
 
-  auto left = (newDenominator / leftDenominator) * leftNumerator;
-  auto right = (newDenominator / rightDenominator) * rightNumerator;
+  auto left = (newDenominator / this->denominator) * this->numerator;
+  auto right = (newDenominator / o.denominator) * o.numerator;
 
-  return std::make_tuple(left, right, newDenominator);
+  return std::make_tuple(std::move(left), std::move(right), std::move(newDenominator));
 }
 
 Rational &Rational::simplify() {
+  if (_small) return *this;
+
   if (numerator == 0) {
     denominator = Integer{1};
   }
-  if (denominator == 1) return *this;
-
-  auto gcd = greatestCommonDivisor(numerator, denominator);
-  this->numerator /= gcd;
-  this->denominator /= gcd;
+  if (denominator != 1) {
+    auto gcd = greatestCommonDivisor(numerator, denominator);
+    if (gcd != 1) {
+      this->numerator /= gcd;
+      this->denominator /= gcd;
+    }
+  }
+  demote();
 
   // FIXME: We shouldn't be returning "this", this makes it ambiguous whether this method edits in place or not
   return *this;
@@ -22,24 +22,35 @@
 
 #pragma once
 
+#include "common/coroutines.h"
 #include "common/numbers/integer.h"
 
-#include <cstdint> // intmax_t
+#include <cstddef> // size_t
+#include <cstdint> // intmax_t, uint8_t
 #include <string>
 #include <tuple>
-#include <utility> // std::move
+#include <utility> // std::move, std::pair
 
 namespace pzl {
 
 struct Rational {
 
-  explicit Rational(const std::string &value) : numerator{value}, denominator{1} {}
+  explicit Rational(const std::string &value) : Rational(pzl::Integer{value}) {}
 
-  explicit Rational(intmax_t value) : numerator{value}, denominator{1} {}
+  explicit Rational(intmax_t value) : Rational(value, 1) {}
   Rational(intmax_t numerator, intmax_t denominator);
 
-  explicit Rational(pzl::Integer numerator) : numerator{std::move(numerator)}, denominator{1} {}
-  Rational(pzl::Integer numerator, const pzl::Integer &denominator);
+  explicit Rational(pzl::Integer numerator) : Rational(std::move(numerator), pzl::Integer{1}) {}
+  Rational(pzl::Integer numerator, pzl::Integer denominator);
+
+  // Lazy Rationals don't get simplified after every operation, which adds up over long chains of them. Instead, that
+  // waits until they've doubled in size since the last time, or grown past this many bits, whichever's bigger.
+  // Operating on a lazy Rational gives back a lazy Rational, and eager() simplifies it back into a regular one
+  static inline size_t lazyThreshold = 4096;
+
+  [[nodiscard]] Rational lazy() const;
+  [[nodiscard]] Rational eager() const;
+  [[nodiscard]] inline bool isLazy() const { return _lazy; }
 
   [[nodiscard]] Rational operator+(const Rational &) const;
   [[nodiscard]] Rational operator-(const Rational &) const;
@@ -53,29 +64,54 @@ struct Rational {
   void operator*=(const Rational &o) { *this = *this * o; }
 
   [[nodiscard]] bool operator<(const Rational &) const;
-  // TODO: <= Could be more efficient
-  [[nodiscard]] inline bool operator<=(const Rational &o) const { return *this < o || *this == o; }
-  [[nodiscard]] inline bool operator>=(const Rational &o) const { return o < *this; }
+  [[nodiscard]] inline bool operator<=(const Rational &o) const { return !(o < *this); }
+  [[nodiscard]] inline bool operator>=(const Rational &o) const { return !(*this < o); }
   [[nodiscard]] bool operator==(const Rational &) const;
 
-  [[nodiscard]] inline bool operator==(intmax_t o) const { return this->denominator == 1 && this->numerator == o; }
+  [[nodiscard]] inline bool operator==(intmax_t o) const {
+    if (_small) return this->smallDenominator == 1 && this->smallNumerator == o;
+    if (_lazy) return this->numerator == this->denominator * o;
+    return this->denominator == 1 && this->numerator == o;
+  }
   [[nodiscard]] inline bool operator!=(intmax_t o) const { return !(*this == o); }
 
   [[nodiscard]] std::string toString() const;
   [[nodiscard]] std::string toStringWithDecimalExpansion() const;
 
+  // The digits after the decimal point of the absolute value, one at a time and forever, so terminating expansions just
+  // carry on with zeroes
+  [[nodiscard]] Puzzles::LazySequence<uint8_t> decimalDigits() const;
+  // How many of those digits come before they start repeating, and how many repeat, with terminating expansions having
+  // a period of zero. Only the remainders get looked at, never the digits, and just two of them are kept at a time
+  [[nodiscard]] std::pair<size_t, size_t> decimalPeriod() const;
+
 private:
-  pzl::Integer numerator;
-  pzl::Integer denominator;
+  // Most values fit in machine words, and those skip Integer altogether, until an operation overflows them. Simplified
+  // values that fit are always kept this way, so each value has a single representation
+  bool _small = false;
+  intmax_t smallNumerator = 0;
+  intmax_t smallDenominator = 1;
 
-  inline Rational &copy(const Rational &o) {
-    this->numerator = o.numerator;
-    this->denominator = o.denominator;
-    return *this;
-  }
+  pzl::Integer numerator{0};
+  pzl::Integer denominator{1};
+  bool _lazy = false;
+  size_t _lazyLimit = 0; // In bits, lazy Rationals get simplified once they grow past this
+
+  Rational() = default;
+
+  // Denominator has to be positive already, the result is only simplified if it's eager or has grown past lazyLimit
+  Rational(pzl::Integer numerator, pzl::Integer denominator, bool lazy, size_t lazyLimit);
+
+  // Numerator and denominator have to be simplified already, with a positive denominator, and neither can be INTMAX_MIN
+  [[nodiscard]] static Rational small(intmax_t numerator, intmax_t denominator, bool lazy, size_t lazyLimit);
+
+  // The same value, but held in Integers
+  [[nodiscard]] Rational big() const;
+  // Switches back to machine words if the value fits, it has to be simplified already
+  void demote();
 
   [[nodiscard]] std::tuple<pzl::Integer, pzl::Integer, pzl::Integer> normalizeDenominatorWith(const Rational &) const;
-  [[nodiscard]] inline bool positive() const { return numerator.positive(); }
+  [[nodiscard]] inline bool positive() const { return _small ? smallNumerator >= 0 : numerator.positive(); }
 
   Rational &simplify();
 };
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "common/assertions.h"
+
+#include <algorithm>   // std::copy, std::equal, std::fill
+#include <cstddef>     // size_t
+#include <cstdint>     // uint32_t
+#include <iterator>    // std::reverse_iterator
+#include <type_traits> // std::is_trivially_copyable_v
+
+namespace pzl {
+
+// A std::vector look-alike that keeps up to InlineCapacity items inside the object itself, and only goes to the heap
+// when it grows past that
+template <typename T, size_t InlineCapacity>
+struct SmallVector {
+  static_assert(std::is_trivially_copyable_v<T>, "SmallVector only supports trivially copyable types");
+  static_assert(InlineCapacity > 0);
+
+  using value_type = T;
+  using size_type = size_t;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  // Constructors
+  SmallVector() = default;
+  explicit SmallVector(size_t count, T value = T{}) { resize(count, value); }
+  SmallVector(const T *first, const T *last) { assign(first, last); }
+
+  SmallVector(const SmallVector &o) { assign(o.begin(), o.end()); }
+  SmallVector(SmallVector &&o) noexcept { steal(&o); }
+
+  ~SmallVector() { release(); }
+
+  // Operators
+  SmallVector &operator=(const SmallVector &o) {
+    if (this != &o) assign(o.begin(), o.end());
+    return *this;
+  }
+
+  SmallVector &operator=(SmallVector &&o) noexcept {
+    if (this != &o) {
+      release();
+      steal(&o);
+    }
+    return *this;
+  }
+
+  [[nodiscard]] inline bool operator==(const SmallVector &o) const {
+    return _size == o._size && std::equal(begin(), end(), o.begin());
+  }
+  [[nodiscard]] inline bool operator!=(const SmallVector &o) const { return !(*this == o); }
+
+  // Capacity
+  [[nodiscard]] inline bool empty() const { return _size == 0; }
+  [[nodiscard]] inline size_t size() const { return _size; }
+  [[nodiscard]] inline size_t capacity() const { return _capacity; }
+  [[nodiscard]] inline bool isInline() const { return _capacity == InlineCapacity; }
+
+  void reserve(size_t newCapacity) {
+    if (newCapacity <= _capacity) return;
+
+    auto newStorage = new T[newCapacity];
+    std::copy(begin(), end(), newStorage);
+    release();
+
+    storage.heap = newStorage;
+    _capacity = static_cast<uint32_t>(newCapacity);
+  }
+
+  void shrink_to_fit() {
+    if (isInline() || _size > InlineCapacity) return;
+
+    auto heap = storage.heap;
+    std::copy(heap, heap + _size, storage.local);
+    delete[] heap;
+    _capacity = InlineCapacity;
+  }
+
+  // Modifiers
+  inline void clear() { _size = 0; }
+
+  inline void push_back(T value) {
+    if (_size == _capacity) reserve(_capacity * 2);
+    data()[_size++] = value;
+  }
+
+  inline void pop_back() {
+    ensure(_size > 0);
+    --_size;
+  }
+
+  void resize(size_t count, T value = T{}) {
+    if (count > _size) {
+      reserve(count);
+      std::fill(end(), begin() + count, value);
+    }
+    _size = static_cast<uint32_t>(count);
+  }
+
+  void assign(const T *first, const T *last) {
+    auto count = static_cast<size_t>(last - first);
+    clear();
+    reserve(count);
+    std::copy(first, last, data());
+    _size = static_cast<uint32_t>(count);
+  }
+
+  // Element access
+  [[nodiscard]] inline T *data() { return isInline() ? storage.local : storage.heap; }
+  [[nodiscard]] inline const T *data() const { return isInline() ? storage.local : storage.heap; }
+
+  [[nodiscard]] inline T &operator[](size_t i) { return data()[i]; }
+  [[nodiscard]] inline const T &operator[](size_t i) const { return data()[i]; }
+
+  [[nodiscard]] inline T &front() { return data()[0]; }
+  [[nodiscard]] inline const T &front() const { return data()[0]; }
+  [[nodiscard]] inline T &back() { return data()[_size - 1]; }
+  [[nodiscard]] inline const T &back() const { return data()[_size - 1]; }
+
+  // Iterators
+  [[nodiscard]] inline iterator begin() { return data(); }
+  [[nodiscard]] inline const_iterator begin() const { return data(); }
+  [[nodiscard]] inline const_iterator cbegin() const { return data(); }
+  [[nodiscard]] inline iterator end() { return data() + _size; }
+  [[nodiscard]] inline const_iterator end() const { return data() + _size; }
+  [[nodiscard]] inline const_iterator cend() const { return data() + _size; }
+
+  [[nodiscard]] inline reverse_iterator rbegin() { return reverse_iterator(end()); }
+  [[nodiscard]] inline const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+  [[nodiscard]] inline const_reverse_iterator crbegin() const { return const_reverse_iterator(end()); }
+  [[nodiscard]] inline reverse_iterator rend() { return reverse_iterator(begin()); }
+  [[nodiscard]] inline const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+  [[nodiscard]] inline const_reverse_iterator crend() const { return const_reverse_iterator(begin()); }
+
+private:
+  union Storage {
+    T local[InlineCapacity];
+    T *heap;
+  } storage;
+  uint32_t _size = 0;
+  uint32_t _capacity = InlineCapacity;
+
+  inline void release() {
+    if (!isInline()) {
+      delete[] storage.heap;
+      _capacity = InlineCapacity;
+    }
+  }
+
+  inline void steal(SmallVector *o) {
+    if (o->isInline()) {
+      std::copy(o->begin(), o->end(), storage.local);
+    } else {
+      storage.heap = o->storage.heap;
+      _capacity = o->_capacity;
+      o->_capacity = InlineCapacity;
+    }
+    _size = o->_size;
+    o->_size = 0;
+  }
+};
+}
@@ -46,6 +46,8 @@ int main(int argc, char *argv[]) {
   function<bool()> execution;
   if (arg == "comsci") {
     execution = [=] { return ComSci::run(); };
+  } else if (arg == "bench") {
+    execution = [=] { return Maths::runBenchmarks() && Shurikens::runBenchmarks(); };
   } else {
     execution = [=] {
       return ComSci::run() && CPic::run() && Maths::run() && Shurikens::run(fullRun) && Sudoku::run();
@@ -0,0 +1,541 @@
+/*
+ * Copyright (c) 2026 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "runner.h"
+
+#include "common/assertions.h" // UNUSED
+#include "common/numbers/fixed_integer.h"
+#include "common/numbers/integer.h"
+#include "common/numbers/integers.h"
+#include "common/numbers/rational.h"
+#include "common/runners.h"
+#include "maths/primes.h"
+#include "maths/sequences.h"
+
+#include <algorithm> // std::is_sorted, std::max, std::sort
+#include <array>     // std::array
+#include <cstddef>   // size_t
+#include <iostream>  // std::cout
+#include <limits>    // std::numeric_limits
+#include <random>    // std::mt19937
+#include <string>    // std::string
+#include <utility>   // std::make_pair
+#include <vector>    // std::vector
+
+using pzl::FixedInteger;
+using pzl::Integer;
+using pzl::Rational;
+
+using Puzzles::runningTime;
+
+using std::cout;
+
+namespace {
+
+// Creates a pseudo-random Integer with exactly `slices` base-2^32 slices, each of which holds ~9.63 decimal digits
+Integer randomInteger(size_t slices, std::mt19937 *random) {
+  std::uniform_int_distribution<int> firstDigit{1, 9};
+  std::uniform_int_distribution<int> digit{0, 9};
+
+  std::string value(slices * 963 / 100, '0');
+  value[0] = static_cast<char>('0' + firstDigit(*random));
+  for (size_t i = 1; i < value.size(); ++i) {
+    value[i] = static_cast<char>('0' + digit(*random));
+  }
+
+  return Integer{value};
+}
+
+// Keeps the compiler from optimizing away values we only compute to time them
+template <typename T>
+inline void keep(const T &value) {
+  asm volatile("" : : "r"(&value) : "memory");
+}
+
+template <typename Operation>
+auto timesPerOperation(size_t iterations, const Operation &operation) {
+  auto [_, duration] = runningTime([iterations, &operation] {
+    for (size_t i = 0; i < iterations; ++i) {
+      keep(operation());
+    }
+    return true;
+  });
+  UNUSED(_);
+
+  return static_cast<double>(duration) / static_cast<double>(iterations);
+}
+
+// Times every multiplication algorithm for each size, so the crossover points can be read off the output
+bool runMultiplicationBenchmark() {
+  constexpr std::array<size_t, 8> sizes{1, 10, 100, 300, 1000, 3000, 10000, 30000};
+  constexpr auto never = std::numeric_limits<size_t>::max();
+  const auto defaultKaratsubaThreshold = Integer::karatsubaThreshold;
+  const auto defaultToomCookThreshold = Integer::toomCookThreshold;
+  const auto defaultNttThreshold = Integer::nttThreshold;
+
+  std::mt19937 random{42};
+
+  for (auto size : sizes) {
+    auto left = randomInteger(size, &random);
+    auto right = randomInteger(size, &random);
+    auto iterations = std::max<size_t>(1, 1000000 / (size * size));
+
+    struct Algorithm {
+      const char *name;
+      size_t karatsubaThreshold, toomCookThreshold, nttThreshold;
+    };
+    // Each algorithm only runs at the top level, below that it's the usual thresholds, so comparing them tells which
+    // one should be chosen for this size
+    const std::array<Algorithm, 4> algorithms{
+        Algorithm{"schoolbook", never, never, never},
+        Algorithm{"Karatsuba", defaultKaratsubaThreshold, std::max(size + 1, defaultToomCookThreshold), never},
+        Algorithm{"Toom-3", defaultKaratsubaThreshold, size, std::max(size + 1, defaultNttThreshold)},
+        Algorithm{"NTT", defaultKaratsubaThreshold, defaultToomCookThreshold, size}};
+
+    Integer expected{0};
+    cout << "Maths: Benchmark! Multiplying " << size << "-slice Integers took";
+    for (const auto &algorithm : algorithms) {
+      Integer::karatsubaThreshold = algorithm.karatsubaThreshold;
+      Integer::toomCookThreshold = algorithm.toomCookThreshold;
+      Integer::nttThreshold = algorithm.nttThreshold;
+
+      if (&algorithm == &algorithms.front()) {
+        expected = left * right;
+      } else if (left * right != expected) {
+        cout << "\nMaths: Failure! " << algorithm.name << " and schoolbook multiplication disagree on " << size
+             << "-slice operands\n";
+        return false;
+      }
+
+      auto time = timesPerOperation(iterations, [&left, &right] { return left * right; });
+      cout << (&algorithm == &algorithms.front() ? " " : ", ") << time << " µs with " << algorithm.name;
+    }
+    cout << "\n";
+  }
+
+  Integer::karatsubaThreshold = defaultKaratsubaThreshold;
+  Integer::toomCookThreshold = defaultToomCookThreshold;
+  Integer::nttThreshold = defaultNttThreshold;
+  return true;
+}
+
+bool runGreatestCommonDivisorBenchmark() {
+  constexpr std::array<size_t, 4> sizes{10, 100, 1000, 10000};
+
+  std::mt19937 random{42};
+
+  for (auto size : sizes) {
+    auto common = randomInteger(size / 2, &random);
+    auto left = common * randomInteger(size / 2, &random);
+    auto right = common * randomInteger(size / 2, &random);
+    auto iterations = std::max<size_t>(1, 100000 / (size * size));
+
+    auto gcd = greatestCommonDivisor(left, right);
+    if (gcd % common != 0) {
+      cout << "Maths: Failure! The greatest common divisor of " << size << "-slice Integers is wrong\n";
+      return false;
+    }
+    auto duration = timesPerOperation(iterations, [&left, &right] { return greatestCommonDivisor(left, right); });
+
+    cout << "Maths: Benchmark! The greatest common divisor of " << size << "-slice Integers took " << duration
+         << " µs\n";
+  }
+
+  return true;
+}
+
+bool runLazyRationalBenchmark() {
+  constexpr auto terms = 10000;
+
+  // The denominators keep repeating, like when adding up prices or measurements, so the simplified sum stays small
+  auto sum = [](Rational initial) {
+    for (auto i = 1; i <= terms; ++i) {
+      initial += Rational{i, 1 + i % 360};
+    }
+    return initial.eager();
+  };
+
+  auto [eager, eagerDuration] = runningTime([&sum] { return sum(Rational{0}); });
+  auto [lazy, lazyDuration] = runningTime([&sum] { return sum(Rational{0}.lazy()); });
+
+  if (eager != lazy) {
+    cout << "Maths: Failure! Eager and lazy Rationals disagree on the sum of " << terms << " terms\n";
+    return false;
+  }
+
+  cout << "Maths: Benchmark! Summing " << terms << " Rationals took " << eagerDuration << " µs eagerly and "
+       << lazyDuration << " µs lazily\n";
+  return true;
+}
+
+bool runRationalSortingBenchmark() {
+  constexpr size_t count = 100000;
+
+  std::mt19937 random{42};
+  std::uniform_int_distribution<intmax_t> numerator{-1000000000, 1000000000};
+  std::uniform_int_distribution<intmax_t> denominator{1, 1000000000};
+
+  std::vector<Rational> values;
+  values.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    values.emplace_back(numerator(random), denominator(random));
+  }
+
+  auto [_, duration] = runningTime([&values] {
+    std::sort(values.begin(), values.end());
+    return true;
+  });
+  UNUSED(_);
+
+  if (!std::is_sorted(values.begin(), values.end())) {
+    cout << "Maths: Failure! Sorting " << count << " Rationals didn't work\n";
+    return false;
+  }
+
+  cout << "Maths: Benchmark! Sorting " << count << " Rationals took " << duration << " µs\n";
+  return true;
+}
+
+bool runMachineWordRationalBenchmark() {
+  constexpr size_t iterations = 100000;
+
+  // The same fractions, once with word-sized terms and once scaled past 64 bits, where they have to use Integers
+  Rational small{355, 113}, otherSmall{-22, 7};
+  auto scale = Rational{Integer{"18446744073709551616"}};
+  auto big = small * scale, otherBig = otherSmall * scale;
+  if (!(big / scale == small) || !((small + otherSmall) * scale == big + otherBig)) {
+    cout << "Maths: Failure! Word-sized and big Rationals disagree\n";
+    return false;
+  }
+
+  auto time = [iterations](const Rational &left, const Rational &right) {
+    return std::array{timesPerOperation(iterations, [&left, &right] { return left + right; }),
+                      timesPerOperation(iterations, [&left, &right] { return left * right; }),
+                      timesPerOperation(iterations, [&left, &right] { return left / right; }),
+                      timesPerOperation(iterations, [&left, &right] { return left < right; })};
+  };
+  auto smallTimes = time(small, otherSmall);
+  auto bigTimes = time(big, otherBig);
+
+  const std::array names{"Adding", "Multiplying", "Dividing", "Comparing"};
+  for (size_t i = 0; i < names.size(); ++i) {
+    cout << "Maths: Benchmark! " << names[i] << " word-sized Rationals took " << smallTimes[i] * 1000
+         << " ns, and past 64 bits took " << bigTimes[i] * 1000 << " ns\n";
+  }
+  return true;
+}
+
+bool runDecimalConversionBenchmark() {
+  constexpr std::array<size_t, 3> lengths{10000, 100000, 1000000};
+
+  std::mt19937 random{42};
+  std::uniform_int_distribution<int> digit{0, 9};
+
+  for (auto length : lengths) {
+    std::string digits(length, '1');
+    for (size_t i = 1; i < length; ++i) {
+      digits[i] = static_cast<char>('0' + digit(random));
+    }
+
+    auto [integer, parsing] = runningTime([&digits] { return Integer{digits}; });
+    auto [string, printing] = runningTime([&integer = integer] { return integer.toString(); });
+
+    if (string != digits) {
+      cout << "Maths: Failure! Converting " << length << " digits to an Integer and back didn't round trip\n";
+      return false;
+    }
+
+    cout << "Maths: Benchmark! Converting " << length << " digits to an Integer took " << parsing
+         << " µs, and back took " << printing << " µs\n";
+  }
+
+  return true;
+}
+
+bool runDecimalExpansionBenchmark() {
+  // 10 is a primitive root of this prime, so the period of its reciprocal is as long as it gets
+  constexpr intmax_t prime = 1000171;
+  const auto reciprocal = Rational{1, prime};
+
+  auto [period, periodDuration] = runningTime([&reciprocal] { return reciprocal.decimalPeriod(); });
+  auto [expansion, expansionDuration] =
+      runningTime([&reciprocal] { return reciprocal.toStringWithDecimalExpansion(); });
+
+  if (period != std::make_pair(size_t{0}, size_t{prime - 1}) || expansion.length() != prime + 3) {
+    cout << "Maths: Failure! The decimal expansion of 1/" << prime << " didn't have the right period\n";
+    return false;
+  }
+
+  cout << "Maths: Benchmark! Finding the period of 1/" << prime << " took " << periodDuration
+       << " µs, and expanding it took " << expansionDuration << " µs\n";
+  return true;
+}
+
+bool runMultiplicativeOrderBenchmark() {
+  constexpr uintmax_t limit = 10000;
+
+  // Every n > 1 that's coprime to 10 has a purely periodic 1/n, with the multiplicative order of 10 as its period
+  uintmax_t periods = 0, orders = 0;
+  auto [_, periodDuration] = runningTime([&periods] {
+    for (auto n = 3u; n < limit; ++n) {
+      if (n % 2 != 0 && n % 5 != 0) periods += Rational{1, n}.decimalPeriod().second;
+    }
+    return true;
+  });
+  auto [__, orderDuration] = runningTime([&orders] {
+    for (auto n = 3u; n < limit; ++n) {
+      if (n % 2 != 0 && n % 5 != 0) orders += Maths::multiplicativeOrder(10, n);
+    }
+    return true;
+  });
+  UNUSED(_);
+  UNUSED(__);
+
+  if (periods != orders) {
+    cout << "Maths: Failure! Decimal periods and multiplicative orders disagree below " << limit << "\n";
+    return false;
+  }
+
+  cout << "Maths: Benchmark! Finding the period of 1/n for every n below " << limit << " took " << periodDuration
+       << " µs with long division, and " << orderDuration << " µs with multiplicative orders\n";
+  return true;
+}
+
+bool runPrimalityBenchmark() {
+  constexpr size_t iterations = 100000;
+
+  // The biggest 64-bit prime, and the biggest semiprime with two 32-bit factors, which both go through every witness
+  uintmax_t prime = 18446744073709551557u, semiprime = uintmax_t{4294967291u} * 4294967279u;
+  const auto bigPrime = Integer{"170141183460469231731687303715884105727"};
+
+  if (!Maths::isPrime(prime) || Maths::isPrime(semiprime) || !pzl::isProbablePrime(bigPrime)) {
+    cout << "Maths: Failure! Primality tests got the wrong answers\n";
+    return false;
+  }
+
+  // Otherwise these could get worked out at compile time
+  keep(prime);
+  keep(semiprime);
+  auto primeDuration = timesPerOperation(iterations, [&prime] { return Maths::isPrime(prime); });
+  auto semiprimeDuration = timesPerOperation(iterations, [&semiprime] { return Maths::isPrime(semiprime); });
+  auto bigDuration = timesPerOperation(100, [&bigPrime] { return pzl::isProbablePrime(bigPrime); });
+
+  cout << "Maths: Benchmark! Testing a 64-bit prime took " << primeDuration * 1000 << " ns, a 64-bit semiprime took "
+       << semiprimeDuration * 1000 << " ns, and 2^127 - 1 took " << bigDuration << " µs\n";
+  return true;
+}
+
+bool runFactorizationBenchmark() {
+  constexpr size_t count = 1000;
+
+  // Random 64-bit numbers, plus the semiprimes that are hardest for Pollard's rho, with two factors of about 32 bits
+  std::mt19937_64 random{42};
+  std::vector<uintmax_t> numbers;
+  for (size_t i = 0; i < count; ++i) {
+    numbers.push_back(random() | 1);
+  }
+  const std::vector<uintmax_t> semiprimes{uintmax_t{4294967291u} * 4294967279u, uintmax_t{4294967231u} * 4294967197u,
+                                          uintmax_t{4294967189u} * 4294967161u, uintmax_t{4294967143u} * 4294967111u};
+
+  auto factorizeAll = [](const std::vector<uintmax_t> &values) {
+    for (auto value : values) {
+      uintmax_t product = 1;
+      for (auto [prime, exponent] : Maths::factorize(value)) {
+        for (size_t i = 0; i < exponent; ++i) {
+          product *= prime;
+        }
+      }
+      if (product != value) return false;
+    }
+    return true;
+  };
+
+  auto [randomResult, randomDuration] = runningTime([&numbers, &factorizeAll] { return factorizeAll(numbers); });
+  auto [semiprimeResult, semiprimeDuration] =
+      runningTime([&semiprimes, &factorizeAll] { return factorizeAll(semiprimes); });
+
+  if (!randomResult || !semiprimeResult) {
+    cout << "Maths: Failure! Some factorizations didn't multiply back into the original numbers\n";
+    return false;
+  }
+
+  cout << "Maths: Benchmark! Factorizing random 64-bit numbers took " << randomDuration / static_cast<long>(count)
+       << " µs each, and hard 64-bit semiprimes took "
+       << semiprimeDuration / static_cast<long>(semiprimes.size()) << " µs each\n";
+  return true;
+}
+
+#if !defined(__cpp_impl_coroutine)
+bool runPrimeSieveBenchmark() {
+  cout << "Maths: Skipping the prime sieve benchmark due to lack of compiler support\n";
+  return true;
+}
+
+bool runEmirpsBenchmark() {
+  cout << "Maths: Skipping the emirps benchmark due to lack of compiler support\n";
+  return true;
+}
+#else  // !defined(__cpp_impl_coroutine)
+bool runPrimeSieveBenchmark() {
+  constexpr uintmax_t testingCount = 1000000, sieveCount = 10000000;
+
+  auto [testingLast, testingDuration] = runningTime([] {
+    uintmax_t found = 0, candidate = 1;
+    while (found < testingCount) {
+      if (Maths::isPrime(++candidate)) ++found;
+    }
+    return candidate;
+  });
+
+  auto [sieveLast, sieveDuration] = runningTime([] {
+    auto primes = Maths::Sequences::primes();
+    auto it = primes.begin();
+    for (uintmax_t i = 1; i < sieveCount; ++i) {
+      ++it;
+    }
+    return *it;
+  });
+
+  // The 10^6th and 10^7th primes
+  if (testingLast != 15485863 || sieveLast != 179424673) {
+    cout << "Maths: Failure! Got the wrong primes, " << testingLast << " and " << sieveLast << "\n";
+    return false;
+  }
+
+  cout << "Maths: Benchmark! Finding the first " << testingCount << " primes with isPrime took " << testingDuration
+       << " µs, and the first " << sieveCount << " with a segmented sieve took " << sieveDuration << " µs\n";
+  return true;
+}
+
+bool runEmirpsBenchmark() {
+  constexpr uintmax_t count = 1000000;
+
+  auto [last, duration] = runningTime([] {
+    auto emirps = Maths::Sequences::emirps();
+    auto it = emirps.begin();
+    for (uintmax_t i = 1; i < count; ++i) {
+      ++it;
+    }
+    return *it;
+  });
+
+  if (last != 134400823) {
+    cout << "Maths: Failure! The " << count << "th emirp should be 134400823, but got " << last << "\n";
+    return false;
+  }
+
+  cout << "Maths: Benchmark! Finding the first " << count << " emirps took " << duration << " µs, "
+       << count * 1000000 / static_cast<uintmax_t>(duration) << " per second\n";
+  return true;
+}
+#endif // !defined(__cpp_impl_coroutine)
+
+bool runHighlyCompositeNumbersBenchmark() {
+  auto [numbers, duration] =
+      runningTime([] { return Maths::Sequences::highlyCompositeNumbersUpTo(pzl::Integer{"1000000000000000000"}); });
+
+  if (numbers.size() != 156 || numbers.back() != pzl::Integer{"897612484786617600"}) {
+    cout << "Maths: Failure! Found " << numbers.size() << " highly composite numbers up to 10^18\n";
+    return false;
+  }
+
+  cout << "Maths: Benchmark! Finding every highly composite number up to 10^18 took " << duration << " µs\n";
+  return true;
+}
+
+bool runIntegerRootBenchmark() {
+  constexpr std::array<size_t, 3> sizes{100, 1000, 10000};
+
+  std::mt19937 random{42};
+
+  for (auto size : sizes) {
+    auto value = randomInteger(size, &random);
+
+    auto [root, squareRoot] = runningTime([&value] { return isqrt(value); });
+    if (root * root > value || (root + 1) * (root + 1) <= value) {
+      cout << "Maths: Failure! The square root of a " << size << "-slice Integer is wrong\n";
+      return false;
+    }
+
+    auto [_, cubeRoot] = runningTime([&value] { return iroot(value, 3); });
+    UNUSED(_);
+
+    cout << "Maths: Benchmark! The square root of a " << size << "-slice Integer took " << squareRoot
+         << " µs, and its cube root took " << cubeRoot << " µs\n";
+  }
+
+  return true;
+}
+
+// Runs the same operations with Integer and FixedInteger<Bits>, on operands half as wide so their products still fit
+template <size_t Bits>
+bool runFixedIntegerBenchmark() {
+  constexpr size_t iterations = 100000;
+
+  std::mt19937 random{42};
+  auto left = randomInteger(Bits / 64, &random);
+  auto right = randomInteger(Bits / 64, &random);
+  auto product = left * right;
+
+  using Fixed = FixedInteger<Bits>;
+  Fixed fixedLeft{left.toString()}, fixedRight{right.toString()}, fixedProduct{product.toString()};
+  if ((fixedLeft * fixedRight).toString() != product.toString() ||
+      greatestCommonDivisor(fixedProduct, fixedLeft).toString() != greatestCommonDivisor(product, left).toString()) {
+    cout << "Maths: Failure! Integer and FixedInteger<" << Bits << "> disagree\n";
+    return false;
+  }
+
+  // Otherwise the compiler can work out every FixedInteger result beforehand
+  keep(fixedLeft);
+  keep(fixedRight);
+  keep(fixedProduct);
+
+  auto compare = [](const char *operation, const auto &integerOperation, const auto &fixedOperation) {
+    auto integer = timesPerOperation(iterations, integerOperation);
+    auto fixed = timesPerOperation(iterations, fixedOperation);
+    cout << "Maths: Benchmark! " << operation << " " << Bits << "-bit values took " << integer
+         << " µs with Integer and " << fixed << " µs with FixedInteger\n";
+  };
+
+  compare(
+      "Multiplying", [&] { return left * right; }, [&] { return fixedLeft * fixedRight; });
+  compare(
+      "Dividing", [&] { return product / right; }, [&] { return fixedProduct / fixedRight; });
+  compare(
+      "The greatest common divisor of", [&] { return greatestCommonDivisor(product, left); },
+      [&] { return greatestCommonDivisor(fixedProduct, fixedLeft); });
+  compare(
+      "The greatest power of two under", [&] { return greatestPowerOfTwo(product); },
+      [&] { return greatestPowerOfTwo(fixedProduct); });
+
+  return true;
+}
+}
+
+bool Maths::runBenchmarks() {
+  return runMultiplicationBenchmark() && runGreatestCommonDivisorBenchmark() && runLazyRationalBenchmark() &&
+         runRationalSortingBenchmark() && runMachineWordRationalBenchmark() && runDecimalConversionBenchmark() &&
+         runDecimalExpansionBenchmark() && runMultiplicativeOrderBenchmark() && runPrimalityBenchmark() &&
+         runFactorizationBenchmark() && runPrimeSieveBenchmark() && runEmirpsBenchmark() &&
+         runHighlyCompositeNumbersBenchmark() && runIntegerRootBenchmark() && runFixedIntegerBenchmark<128>() &&
+         runFixedIntegerBenchmark<256>() && runFixedIntegerBenchmark<512>();
+}
@@ -141,7 +141,8 @@ Rational Maths::evaluateExpression(std::string expression) {
     ensure(token != ' ');
 
     if (token.isNumber) {
-      numbers.push(token.asNumber);
+      // Intermediate results don't need simplifying, so they're kept lazy until the very end
+      numbers.push(token.asNumber.lazy());
     } else if (token == '(') {
       operators.push('(');
       parenthesisCount++;
@@ -167,5 +168,5 @@ Rational Maths::evaluateExpression(std::string expression) {
   }
 
   ensure(numbers.size() == 1);
-  return numbers.top();
+  return numbers.top().eager();
 }
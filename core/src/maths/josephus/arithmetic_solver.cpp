@@ -30,7 +30,7 @@ using pzl::Integer;
 
 Integer ArithmeticSolver::solve(const Integer &initialSize) {
   ensure(initialSize > 0);
+  // Writing the size as 2^m + l, the survivor is 2l + 1, which is the size's binary digits rotated left by one
   auto n = pzl::greatestPowerOfTwo(initialSize);
-  auto l = initialSize - n;
-  return l * 2 + 1;
+  return ((initialSize - n) << 1) + 1;
 }
@@ -22,32 +22,270 @@
 
 #pragma once
 
+#include "common/assertions.h"
+
+#include <algorithm> // std::sort
+#include <array>
+#include <bit>       // std::bit_width, std::countr_zero
+#include <cstddef>   // size_t
 #include <cstdint>
+#include <numeric>   // std::gcd
+#include <vector>
 
 namespace Maths {
 
-constexpr bool isPrime(uintmax_t n) {
-  if (n == 1) return false;
-  if (n == 2) return true;
+// Arithmetic modulo an odd number, with every value kept multiplied by 2^64. That makes multiplying two of them a
+// matter of a few 64-bit multiplications and a subtraction, instead of a 128-bit division
+struct Montgomery {
+  using wide_t = unsigned __int128;
+
+  uint64_t modulus;
+  uint64_t inverse;      // modulus * inverse = 1 (mod 2^64)
+  uint64_t one = 0;      // 2^64 mod modulus, which is what 1 looks like in this form
+  uint64_t rSquared = 0; // 2^128 mod modulus, for converting into this form
+
+  constexpr explicit Montgomery(uint64_t modulus) : modulus{modulus}, inverse{modulus} {
+    // Odd numbers are their own inverses modulo 8, and each Newton step doubles how many of the low bits are right
+    for (auto i = 0; i < 5; ++i) {
+      inverse *= 2 - modulus * inverse;
+    }
+    one = (0 - modulus) % modulus;
+    rSquared = static_cast<uint64_t>(static_cast<wide_t>(one) * one % modulus);
+  }
+
+  [[nodiscard]] constexpr uint64_t reduce(wide_t value) const {
+    // With m = value * inverse (mod 2^64), value - m * modulus has no low bits left, so only the high ones matter
+    auto m = static_cast<uint64_t>(value) * inverse;
+    auto high = static_cast<uint64_t>(value >> 64);
+    auto subtracted = static_cast<uint64_t>((static_cast<wide_t>(m) * modulus) >> 64);
+    return high >= subtracted ? high - subtracted : high - subtracted + modulus;
+  }
 
-  if (n % 2 == 0) return false;
+  [[nodiscard]] constexpr uint64_t multiply(uint64_t left, uint64_t right) const {
+    return reduce(static_cast<wide_t>(left) * right);
+  }
+
+  [[nodiscard]] constexpr uint64_t to(uint64_t value) const { return multiply(value % modulus, rSquared); }
+  [[nodiscard]] constexpr uint64_t from(uint64_t value) const { return reduce(value); }
+
+  [[nodiscard]] constexpr uint64_t power(uint64_t base, uint64_t exponent) const {
+    uint64_t result = one;
+    for (; exponent > 0; exponent >>= 1) {
+      if (exponent & 1) result = multiply(result, base);
+      base = multiply(base, base);
+    }
+    return result;
+  }
+};
+
+// One round of Miller-Rabin for each witness. They all go through the same exponent at once, so the multiplier always
+// has something else to do while each of them waits on its last step
+template <size_t Count>
+constexpr bool isStrongProbablePrime(uint64_t n, const std::array<uint64_t, Count> &witnesses) {
+  // n - 1 = d * 2^s, with d odd
+  const auto s = std::countr_zero(n - 1);
+  const auto d = (n - 1) >> s;
 
-  for (auto i = 3u; i < (n / 2); i += 2) {
-    if (n % i == 0) return false;
+  const Montgomery montgomery{n};
+  const auto minusOne = n - montgomery.one;
+
+  std::array<uint64_t, Count> bases{}, x{};
+  for (size_t i = 0; i < Count; ++i) {
+    bases[i] = montgomery.to(witnesses[i]);
+    x[i] = bases[i];
+  }
+  for (auto bit = std::bit_width(d) - 1; bit-- > 0;) {
+    for (size_t i = 0; i < Count; ++i) {
+      x[i] = montgomery.multiply(x[i], x[i]);
+    }
+    if (((d >> bit) & 1) != 0) {
+      for (size_t i = 0; i < Count; ++i) {
+        x[i] = montgomery.multiply(x[i], bases[i]);
+      }
+    }
   }
 
+  for (size_t i = 0; i < Count; ++i) {
+    // Witnesses that are multiples of n don't tell us anything
+    if (bases[i] == 0 || x[i] == montgomery.one || x[i] == minusOne) continue;
+
+    auto composite = true;
+    for (auto j = 1; j < s && composite; ++j) {
+      x[i] = montgomery.multiply(x[i], x[i]);
+      composite = x[i] != minusOne;
+    }
+    if (composite) return false;
+  }
   return true;
 }
 
-constexpr uintmax_t largestPrimeFactor(uintmax_t n) {
-  uintmax_t largest = (n % 2 == 0) ? 2 : 1;
+// Miller-Rabin with fixed sets of witnesses, which are known to get every 64-bit number right
+constexpr bool isPrime(uintmax_t n) {
+  if (n < 2) return false;
+
+  // Most numbers have a small factor, and anything below 37^2 that doesn't is prime
+  constexpr uint64_t smallPrimes[] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37};
+  for (auto prime : smallPrimes) {
+    if (n % prime == 0) return n == prime;
+  }
+  if (n < 37 * 37) return true;
+
+  if (n < 4759123141u) return isStrongProbablePrime<3>(n, {2, 7, 61});
+  // Most composites fail on the first few witnesses, so it's worth checking those before the rest
+  return isStrongProbablePrime<3>(n, {2, 325, 9375}) &&
+         isStrongProbablePrime<4>(n, {28178, 450775, 9780504, 1795265022});
+}
+
+// Finds some factor of n, which has to be odd and composite, with Brent's variant of Pollard's rho. Pseudo-random
+// sequences modulo n are also pseudo-random modulo each of its factors, where they start repeating much sooner, and we
+// can spot that with a gcd. Those gcds get batched, by multiplying a bunch of differences together before each one
+constexpr uint64_t pollardRho(uint64_t n) {
+  constexpr size_t batchSize = 128;
+  const Montgomery montgomery{n};
 
-  for (auto i = 3u; i <= n; i += 2) {
-    if (n % i == 0 && isPrime(i)) {
-      largest = i;
+  auto absoluteDifference = [](uint64_t left, uint64_t right) { return left > right ? left - right : right - left; };
+  for (uint64_t c = 1;; ++c) {
+    const auto increment = montgomery.to(c);
+    auto step = [&montgomery, increment, n](uint64_t value) {
+      auto square = montgomery.multiply(value, value);
+      return square >= n - increment ? square - (n - increment) : square + increment;
+    };
+
+    uint64_t x = 0, y = montgomery.one, lastY = 0, product = montgomery.one, factor = 1;
+    for (size_t length = 1; factor == 1; length *= 2) {
+      x = y;
+      for (size_t i = 0; i < length; ++i) {
+        y = step(y);
+      }
+      for (size_t done = 0; done < length && factor == 1; done += batchSize) {
+        lastY = y;
+        for (size_t i = 0; i < batchSize && done + i < length; ++i) {
+          y = step(y);
+          product = montgomery.multiply(product, absoluteDifference(x, y));
+        }
+        // Montgomery form only multiplies product by something coprime to n, so the gcd stays the same
+        factor = std::gcd(product, n);
+      }
+    }
+
+    if (factor == n) {
+      // Some batch had every factor at once, so we go back over it one step at a time
+      do {
+        lastY = step(lastY);
+        factor = std::gcd(absoluteDifference(x, lastY), n);
+      } while (factor == 1);
     }
+    // If it's still n, this sequence went around the cycle modulo n itself, so we try a different one
+    if (factor != n) return factor;
   }
+}
 
-  return largest;
+struct PrimeFactor {
+  uintmax_t prime;
+  size_t exponent;
+
+  constexpr bool operator==(const PrimeFactor &) const = default;
+};
+
+// The prime factorization of n, from the smallest prime to the biggest. Small factors come out by trial division, and
+// whatever's left after that gets split up with Pollard's rho until every piece is prime. There's no cache in front of
+// it, since its callers hardly ever ask twice: the period sequence, for one, factors a different p - 1 for every prime
+constexpr std::vector<PrimeFactor> factorize(uintmax_t n) {
+  ensure(n > 0);
+  constexpr uintmax_t trialDivisionLimit = 1024;
+
+  std::vector<PrimeFactor> factors;
+  auto divideOut = [&factors, &n](uintmax_t prime) {
+    size_t exponent = 0;
+    for (; n % prime == 0; n /= prime) {
+      ++exponent;
+    }
+    if (exponent > 0) factors.push_back({prime, exponent});
+  };
+
+  divideOut(2);
+  for (uintmax_t i = 3; i < trialDivisionLimit && i * i <= n; i += 2) {
+    divideOut(i);
+  }
+  if (n == 1) return factors;
+
+  std::vector<uintmax_t> pieces{n};
+  std::vector<uintmax_t> primes;
+  while (!pieces.empty()) {
+    auto piece = pieces.back();
+    pieces.pop_back();
+    if (isPrime(piece)) {
+      primes.push_back(piece);
+    } else {
+      auto factor = pollardRho(piece);
+      pieces.push_back(factor);
+      pieces.push_back(piece / factor);
+    }
+  }
+
+  std::sort(primes.begin(), primes.end());
+  for (auto prime : primes) {
+    if (factors.empty() || factors.back().prime != prime) {
+      factors.push_back({prime, 1});
+    } else {
+      ++factors.back().exponent;
+    }
+  }
+  return factors;
+}
+
+constexpr uintmax_t largestPrimeFactor(uintmax_t n) {
+  if (n == 1) return 1;
+  return factorize(n).back().prime;
+}
+
+constexpr uintmax_t divisorCount(uintmax_t n) {
+  uintmax_t count = 1;
+  for (auto [_, exponent] : factorize(n)) {
+    count *= exponent + 1;
+  }
+  return count;
+}
+
+// Calls `callback` once with each distinct prime factor of n, from smallest to largest
+template <typename Callback>
+constexpr void forEachPrimeFactor(uintmax_t n, const Callback &callback) {
+  for (auto [prime, _] : factorize(n)) {
+    callback(prime);
+  }
+}
+
+constexpr uintmax_t eulerTotient(uintmax_t n) {
+  auto totient = n;
+  forEachPrimeFactor(n, [&totient](uintmax_t prime) { totient -= totient / prime; });
+  return totient;
+}
+
+constexpr uintmax_t powMod(uintmax_t base, uintmax_t exponent, uintmax_t modulus) {
+  using wide_t = unsigned __int128;
+
+  uintmax_t result = 1 % modulus;
+  base %= modulus;
+  for (; exponent > 0; exponent >>= 1) {
+    if (exponent & 1) result = static_cast<uintmax_t>(static_cast<wide_t>(result) * base % modulus);
+    base = static_cast<uintmax_t>(static_cast<wide_t>(base) * base % modulus);
+  }
+  return result;
+}
+
+// The smallest k > 0 such that base^k = 1 (mod modulus), or 0 if there's none, which is when they share a factor.
+// For a prime p other than 2 or 5, multiplicativeOrder(10, p) is the period of the decimal expansion of 1/p
+constexpr uintmax_t multiplicativeOrder(uintmax_t base, uintmax_t modulus) {
+  if (modulus == 1) return 1;
+  if (std::gcd(base, modulus) != 1) return 0;
+
+  // The order always divides the totient, so we start there and take out every prime factor that we can
+  auto order = eulerTotient(modulus);
+  forEachPrimeFactor(order, [base, modulus, &order](uintmax_t prime) {
+    while (order % prime == 0 && powMod(base, order / prime, modulus) == 1) {
+      order /= prime;
+    }
+  });
+  return order;
 }
 }
@@ -205,7 +205,9 @@ bool runSteppingStonesPuzzle() {
 }
 
 bool Maths::run() {
-  return runLargestPrimeFactor(13195, 29) && runEvaluateExpression("3 + (4 * 2) ^ 2 ^ 3 / ( 1 - 5 ) ^ 2", 1048579) &&
-         runJosephusProblem(139562, 16981) && runHighlyCompositeNumberSequence() && runEmirpsSequence() &&
-         runPrimeReciprocalPeriodSequence() && runSteppingStonesPuzzle();
+  return runLargestPrimeFactor(13195, 29) && runLargestPrimeFactor(600851475143, 6857) &&
+         runLargestPrimeFactor(18446744073709551615u, 6700417) &&
+         runEvaluateExpression("3 + (4 * 2) ^ 2 ^ 3 / ( 1 - 5 ) ^ 2", 1048579) && runJosephusProblem(139562, 16981) &&
+         runHighlyCompositeNumberSequence() && runEmirpsSequence() && runPrimeReciprocalPeriodSequence() &&
+         runSteppingStonesPuzzle();
 }
@@ -25,4 +25,5 @@
 namespace Maths {
 
 bool run();
+bool runBenchmarks();
 }
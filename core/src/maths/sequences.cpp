@@ -23,56 +23,147 @@
 #include "sequences.h"
 
 #include "maths/primes.h"
+#include "maths/sieve.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
 
 #if __has_include(<version>)
 #include <version>
 #endif
 
-#if defined(__cpp_impl_coroutine)
+using namespace Maths;
 
-#include "common/numbers/rational.h"
+inline bool multiplyUpTo(uintmax_t *value, uintmax_t factor, uintmax_t limit) {
+  if (*value > limit / factor) return false;
+  *value *= factor;
+  return true;
+}
 
-#include "compat/ranges.h" // compat::iota
+inline bool multiplyUpTo(pzl::Integer *value, uintmax_t factor, const pzl::Integer &limit) {
+  *value *= static_cast<intmax_t>(factor);
+  return *value <= limit;
+}
 
-#include <algorithm>
-#include <cinttypes>
+// Sorting the exponents of any n's prime factors, biggest exponent on the smallest prime, gives a number no bigger than
+// n with just as many divisors. So every highly composite number is a product of the first few primes with
+// non-increasing exponents, and those are few enough to just list them all, along with how many divisors they have
+template <typename Number>
+std::vector<std::pair<Number, uintmax_t>> highlyCompositeCandidatesUpTo(const Number &limit) {
+  std::vector<std::pair<Number, uintmax_t>> candidates;
+  std::vector<uintmax_t> primes;
+
+  auto visit = [&](auto &self, const Number &value, uintmax_t divisors, size_t index, size_t maxExponent) -> void {
+    candidates.emplace_back(value, divisors);
+    if (index == primes.size()) {
+      auto prime = primes.empty() ? 2 : primes.back() + 1;
+      while (!isPrime(prime)) ++prime;
+      primes.push_back(prime);
+    }
+
+    auto next = value;
+    for (size_t exponent = 1; exponent <= maxExponent; ++exponent) {
+      if (!multiplyUpTo(&next, primes[index], limit)) break;
+      self(self, next, divisors * (exponent + 1), index + 1, exponent);
+    }
+  };
+  visit(visit, Number{1}, 1, 0, std::numeric_limits<size_t>::max());
+
+  std::sort(candidates.begin(), candidates.end());
+  return candidates;
+}
+
+std::vector<pzl::Integer> Sequences::highlyCompositeNumbersUpTo(const pzl::Integer &limit) {
+  std::vector<pzl::Integer> result;
+  if (limit < 1) return result;
+
+  uintmax_t record = 0;
+  for (const auto &[value, divisors] : highlyCompositeCandidatesUpTo(limit)) {
+    if (divisors > record) {
+      result.push_back(value);
+      record = divisors;
+    }
+  }
+  return result;
+}
+
+#if defined(__cpp_impl_coroutine)
+
+#include <array>
+#include <bit> // std::countr_zero
 #include <execution>
-#include <string>
 
-using namespace Maths;
+inline uintmax_t reverseDigits(uintmax_t value) {
+  uintmax_t result = 0;
+  for (; value != 0; value /= 10) {
+    result = result * 10 + value % 10;
+  }
+  return result;
+}
 
 Puzzles::LazySequence<uintmax_t> Sequences::emirps() {
-  for (uintmax_t i = 0U;; ++i) {
-    if (isPrime(i)) {
-      std::string string = std::to_string(i);
-      std::reverse(string.begin(), string.end());
-      auto reversed = std::strtoumax(string.c_str(), nullptr, 10);
-      if (i != reversed && isPrime(reversed)) {
-        co_yield i;
+  // The reversal ends with the emirp's first digit, and it can't be prime if that's even or 5
+  constexpr std::array<uintmax_t, 4> firstDigits{1, 3, 7, 9};
+
+  // Only the ranges with those first digits get sieved, a segment at a time so memory doesn't grow with the decade.
+  // Reversals land all over the decade, far from the segment we're in, so those are tested one by one instead
+  std::vector<uint64_t> segment;
+  for (uintmax_t powerOfTen = 10;; powerOfTen *= 10) {
+    for (auto digit : firstDigits) {
+      const auto from = digit * powerOfTen, to = from + powerOfTen;
+
+      SegmentedSieve sieve{from};
+      for (auto index = from / 2; index < to / 2; index += segment.size() * 64) {
+        auto begin = sieve.next(&segment, std::min(SegmentedSieve::segmentWords, (to / 2 - index + 63) / 64));
+        for (size_t word = 0; word < segment.size(); ++word) {
+          for (auto bits = segment[word]; bits != 0; bits &= bits - 1) {
+            auto prime = 2 * (begin + word * 64 + static_cast<size_t>(std::countr_zero(bits))) + 1;
+            if (prime >= to) break;
+
+            auto reversed = reverseDigits(prime);
+            if (prime != reversed && isPrime(reversed)) co_yield prime;
+          }
+        }
       }
     }
   }
 }
 
 Puzzles::LazySequence<uintmax_t> Sequences::highlyCompositeNumbers() {
-  auto lastCount = 0U;
-
-  for (auto number = 0U;; ++number) {
-    auto range = compat::views::iota(1U, number + 1U);
-    auto count = std::count_if(range.begin(), range.end(), [number](auto i) { return number % i == 0; });
-    if (count > lastCount) {
-      co_yield number;
-      lastCount = count;
+  constexpr auto max = std::numeric_limits<uintmax_t>::max();
+
+  // Every window lists all candidates again, but there are so few of them it's not worth remembering the last ones
+  uintmax_t record = 0;
+  uintmax_t lower = 0;
+  for (uintmax_t upper = 1024;; upper = upper > max / 1024 ? max : upper * 1024) {
+    for (auto [value, divisors] : highlyCompositeCandidatesUpTo(upper)) {
+      if (value > lower && divisors > record) {
+        co_yield value;
+        record = divisors;
+      }
     }
+
+    // There are no more highly composite numbers that fit in 64 bits
+    if (upper == max) co_return;
+    lower = upper;
   }
 }
 
 Puzzles::LazySequence<uintmax_t> Sequences::primes() {
-  for (uintmax_t i = 2U;; ++i) {
-    if (isPrime(i)) {
-      co_yield i;
+  co_yield 2U;
+
+  // Segments start out small, so the first few primes come quickly, and double until they're as big as the cache allows
+  SegmentedSieve sieve;
+  std::vector<uint64_t> segment;
+  for (size_t words = 16;; words = std::min(words * 2, SegmentedSieve::segmentWords)) {
+    auto begin = sieve.next(&segment, words);
+    for (size_t word = 0; word < segment.size(); ++word) {
+      for (auto bits = segment[word]; bits != 0; bits &= bits - 1) {
+        co_yield 2 * (begin + word * 64 + static_cast<size_t>(std::countr_zero(bits))) + 1;
+      }
     }
   }
 }
@@ -80,23 +171,8 @@ Puzzles::LazySequence<uintmax_t> Sequences::primes() {
 // TODO: This should've been inlined into periodOfDecimalExpansionOfReciprocalOfPrimes,
 // but it was triggering a GCC bug on the CI server (v11.1 and v11.2)
 uintmax_t calculatePeriodOfDecimalExpansionOfReciprocal(uintmax_t original) {
-  auto next = pzl::Integer{static_cast<intmax_t>(original)};
-
-  auto reciprocal = pzl::Rational{pzl::Integer{1}, next};
-  auto decimalExpansion = reciprocal.toStringWithDecimalExpansion();
-
-  auto begin = decimalExpansion.cbegin();
-  auto end = decimalExpansion.cend();
-  auto periodStartIt = std::find(begin, end, '(');
-
-  if (periodStartIt == end) {
-    return 0U;
-  } else {
-    auto periodStartIndex = static_cast<uintmax_t>(periodStartIt - begin + 1);
-    ensure(decimalExpansion.at(decimalExpansion.length() - 1) == ')');
-    auto periodEndIndex = decimalExpansion.length() - 1;
-    return periodEndIndex - periodStartIndex;
-  }
+  // 1/2 and 1/5 terminate, and multiplicativeOrder has nothing to give back for them either
+  return multiplicativeOrder(10, original);
 }
 
 Puzzles::LazySequence<uintmax_t> Sequences::periodOfDecimalExpansionOfReciprocalOfPrimes() {
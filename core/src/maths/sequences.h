@@ -23,13 +23,17 @@
 #pragma once
 
 #include <cstdint>
+#include <vector>
 
 #include "common/coroutines.h"
+#include "common/numbers/integer.h"
 
 namespace Maths::Sequences {
 
 Puzzles::LazySequence<uintmax_t> emirps();
+// Ends with the last one that fits in 64 bits, use highlyCompositeNumbersUpTo for bigger ones
 Puzzles::LazySequence<uintmax_t> highlyCompositeNumbers();
+std::vector<pzl::Integer> highlyCompositeNumbersUpTo(const pzl::Integer &limit);
 Puzzles::LazySequence<uintmax_t> primes();
 Puzzles::LazySequence<uintmax_t> periodOfDecimalExpansionOfReciprocalOfPrimes();
 }
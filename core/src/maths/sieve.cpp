@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "sieve.h"
+
+#include <algorithm> // std::max, std::min
+#include <array>     // std::array
+#include <cmath>     // std::sqrt
+
+using Maths::SegmentedSieve;
+
+namespace {
+
+constexpr std::array<uintmax_t, 5> wheelPrimes{3, 5, 7, 11, 13};
+constexpr size_t wheelPeriod = 3 * 5 * 7 * 11 * 13; // In bits, so it covers twice as many numbers
+
+// Bit i is set if 2i + 1 isn't a multiple of any wheel prime. It goes a little past one period, so 64 bits starting
+// anywhere inside the first period can be read straight out of it
+std::vector<uint64_t> makeWheelPattern() {
+  std::vector<uint64_t> pattern(wheelPeriod / 64 + 2, 0);
+  for (size_t i = 0; i < pattern.size() * 64; ++i) {
+    auto value = 2 * i + 1;
+    if (std::all_of(wheelPrimes.cbegin(), wheelPrimes.cend(), [value](auto prime) { return value % prime != 0; })) {
+      pattern[i / 64] |= uint64_t{1} << (i % 64);
+    }
+  }
+  return pattern;
+}
+
+inline uint64_t readBits(const std::vector<uint64_t> &bits, size_t offset) {
+  auto word = offset / 64, shift = offset % 64;
+  if (shift == 0) return bits[word];
+  return (bits[word] >> shift) | (bits[word + 1] << (64 - shift));
+}
+
+// A plain sieve of the odd primes up to limit, which only ever needs to go up to the square root of what we're sieving
+std::vector<uintmax_t> oddPrimesUpTo(uintmax_t limit) {
+  std::vector<bool> composite(limit / 2 + 1, false);
+  std::vector<uintmax_t> primes;
+  for (uintmax_t i = 1; 2 * i + 1 <= limit; ++i) {
+    if (composite[i]) continue;
+
+    auto prime = 2 * i + 1;
+    primes.push_back(prime);
+    for (auto multiple = prime * prime; multiple <= limit; multiple += 2 * prime) {
+      composite[multiple / 2] = true;
+    }
+  }
+  return primes;
+}
+}
+
+uintmax_t SegmentedSieve::next(std::vector<uint64_t> *segment, size_t words) {
+  static const auto wheelPattern = makeWheelPattern();
+
+  const auto begin = nextIndex;
+  const auto end = begin + words * 64;
+  addSievingPrimesUpTo(2 * end);
+  nextIndex = end;
+
+  segment->resize(words);
+  auto offset = static_cast<size_t>(begin % wheelPeriod);
+  for (auto &word : *segment) {
+    word = readBits(wheelPattern, offset);
+    offset = (offset + 64) % wheelPeriod;
+  }
+  // The pattern has 1 as a prime and the wheel primes as composites, so we flip them around
+  if (begin == 0) (*segment)[0] &= ~uint64_t{1};
+  for (auto prime : wheelPrimes) {
+    if (auto bit = prime / 2; bit >= begin && bit < end) {
+      (*segment)[(bit - begin) / 64] |= uint64_t{1} << ((bit - begin) % 64);
+    }
+  }
+
+  for (auto &[prime, nextMultiple] : sievingPrimes) {
+    for (; nextMultiple < end; nextMultiple += prime) {
+      auto bit = nextMultiple - begin;
+      (*segment)[bit / 64] &= ~(uint64_t{1} << (bit % 64));
+    }
+  }
+
+  return begin;
+}
+
+// Adds every prime needed to sieve the numbers below end, with their first multiples from the segment at nextIndex on
+void SegmentedSieve::addSievingPrimesUpTo(uintmax_t end) {
+  // Every composite below end has a prime factor no bigger than its square root
+  if (sievingLimit * sievingLimit >= end) return;
+
+  auto newLimit = std::max(sievingLimit * 2, static_cast<uintmax_t>(std::sqrt(static_cast<double>(end))) + 1);
+  for (auto prime : oddPrimesUpTo(newLimit)) {
+    if (prime <= sievingLimit || prime <= wheelPrimes.back()) continue;
+
+    // Smaller multiples have smaller prime factors, so they've either been crossed out already, or will be
+    auto square = (prime * prime) / 2;
+    auto aligned = nextIndex + (prime / 2 + prime - nextIndex % prime) % prime;
+    sievingPrimes.push_back({prime, std::max(square, aligned)});
+  }
+  sievingLimit = newLimit;
+}
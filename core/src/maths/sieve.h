@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef> // size_t
+#include <cstdint> // uint64_t, uintmax_t
+#include <vector>
+
+namespace Maths {
+
+// Sieves the odd numbers a segment at a time, each one small enough to stay in the L1 cache. Bit i of a segment stands
+// for 2i + 1, and is set if that's prime. Multiples of the primes up to 13 come pre-sieved from a repeating pattern, so
+// only the bigger primes have to be crossed out one by one
+struct SegmentedSieve {
+  static constexpr size_t segmentWords = 4096;
+
+  // Starts sieving at the first odd number that isn't below `from`, so ranges far away don't need everything before them
+  explicit SegmentedSieve(uintmax_t from = 0) : nextIndex(from / 2) {}
+
+  // Sieves the next `words` words worth of odd numbers into `segment`, returning the index of its first bit. Anything
+  // bigger than segmentWords is still correct, but it won't fit in the cache anymore
+  uintmax_t next(std::vector<uint64_t> *segment, size_t words = segmentWords);
+
+private:
+  struct SievingPrime {
+    uintmax_t prime;
+    uintmax_t nextMultiple; // As a bit index, the next odd multiple that needs crossing out
+  };
+
+  uintmax_t nextIndex;
+  uintmax_t sievingLimit = 0;
+  std::vector<SievingPrime> sievingPrimes;
+
+  void addSievingPrimesUpTo(uintmax_t end);
+};
+}
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "runner.h"
+
+#include "shurikens/model.h"
+
+#include "common/runners.h"
+
+#include <array>         // std::array
+#include <cstddef>       // size_t
+#include <functional>    // std::hash
+#include <iostream>      // std::cout
+#include <queue>         // std::queue
+#include <unordered_set> // std::unordered_set
+#include <vector>        // std::vector
+
+using namespace Shurikens;
+
+using Puzzles::runningTime;
+
+using std::array;
+using std::cout;
+
+namespace {
+
+// How shurikens used to be stored, one byte per cell with moves copying them around, kept to compare against
+struct UnpackedShuriken {
+  array<Cell, 12> cells;
+
+  // Where each cell comes from after every move
+  static constexpr array<array<size_t, 12>, 6> sources{{{6, 7, 8, 3, 4, 5, 0, 1, 2, 9, 10, 11},
+                                                        {0, 1, 2, 9, 10, 11, 6, 7, 8, 3, 4, 5},
+                                                        {5, 0, 1, 2, 3, 4, 6, 7, 8, 9, 10, 11},
+                                                        {0, 1, 2, 3, 4, 5, 11, 6, 7, 8, 9, 10},
+                                                        {1, 2, 3, 4, 5, 0, 6, 7, 8, 9, 10, 11},
+                                                        {0, 1, 2, 3, 4, 5, 7, 8, 9, 10, 11, 6}}};
+
+  [[nodiscard]] UnpackedShuriken apply(Move move) const {
+    UnpackedShuriken result{};
+    for (size_t i = 0; i < cells.size(); ++i) {
+      result.cells[i] = cells[sources[move][i]];
+    }
+    return result;
+  }
+
+  bool operator==(const UnpackedShuriken &other) const {
+    if (cells == other.cells) return true;
+    for (size_t i = 0; i < 6; ++i) {
+      if (cells[i] != other.cells[i + 6] || cells[i + 6] != other.cells[i]) return false;
+    }
+    return true;
+  }
+};
+
+struct UnpackedShurikenHash {
+  size_t operator()(const UnpackedShuriken &shuriken) const {
+    size_t first = 0;
+    size_t second = 0;
+
+    for (auto i = 0u; i < 6; ++i) {
+      first = (first * 31) + std::hash<int>()(shuriken.cells[i]);
+      second = (second * 31) + std::hash<int>()(shuriken.cells[i + 6]);
+    }
+
+    return first * second;
+  }
+};
+
+// Walks breadth first from `start` until it's seen `count` different shurikens, which is what the solvers spend all
+// their time doing
+template <typename State, typename Hash>
+size_t explore(const State &start, size_t count) {
+  std::unordered_set<State, Hash> seen;
+  seen.reserve(count);
+  seen.insert(start);
+
+  std::queue<State> states;
+  states.push(start);
+  while (seen.size() < count) {
+    auto next = states.front();
+    states.pop();
+
+    for (auto move : allMoves) {
+      auto newState = next.apply(move);
+      if (seen.insert(newState).second) states.push(newState);
+    }
+  }
+  return seen.size();
+}
+
+// The same walk, but marking shurikens off by rank in a bitmap instead of keeping them in a hash set
+size_t exploreRanked(const Shuriken &start, size_t count) {
+  std::vector<bool> seen(Shuriken::count, false);
+  seen[start.rank()] = true;
+  size_t seenCount = 1;
+
+  std::queue<Shuriken> states;
+  states.push(start);
+  while (seenCount < count) {
+    auto next = states.front();
+    states.pop();
+
+    for (auto move : allMoves) {
+      auto newState = next.apply(move);
+      if (auto rank = newState.rank(); !seen[rank]) {
+        seen[rank] = true;
+        ++seenCount;
+        states.push(newState);
+      }
+    }
+  }
+  return seenCount;
+}
+}
+
+bool Shurikens::runBenchmarks() {
+  constexpr size_t count = 1000000;
+
+  auto [unpackedCount, unpackedDuration] = runningTime([] {
+    return explore<UnpackedShuriken, UnpackedShurikenHash>({{A, B, C, D, E, F, G, H, I, J, K, L}}, count);
+  });
+  auto [packedCount, packedDuration] = runningTime([] {
+    return explore<Shuriken, std::hash<Shuriken>>(Shuriken({A, B, C, D, E, F, G, H, I, J, K, L}), count);
+  });
+  auto [rankedCount, rankedDuration] =
+      runningTime([] { return exploreRanked(Shuriken({A, B, C, D, E, F, G, H, I, J, K, L}), count); });
+
+  if (unpackedCount < count || packedCount < count || rankedCount < count) {
+    cout << "Shuriken: Failure! Couldn't find " << count << " different shurikens\n";
+    return false;
+  }
+
+  cout << "Shuriken: Benchmark! Visiting " << count << " shurikens breadth first took " << unpackedDuration
+       << " µs with one byte per cell, " << packedDuration << " µs packed into a word, and " << rankedDuration
+       << " µs ranked into a bitmap, " << count * 1000000 / static_cast<size_t>(rankedDuration)
+       << " states per second\n";
+  return true;
+}
@@ -22,106 +22,71 @@
 
 #include "model.h"
 
-#include "common/assertions.h"
+#include <bit> // std::countr_zero, std::popcount
 
 using namespace Shurikens;
 
 using std::array;
 
-static inline array<Cell, 12> doSwapTop(const array<Cell, 12> &cells) {
-  array<Cell, 12> turned = cells;
-
-  auto cellsBegin = cells.begin();
-  auto turnedBegin = turned.begin();
-  std::copy(cellsBegin, cellsBegin + 3, turnedBegin + 6);
-  std::copy(cellsBegin + 6, cellsBegin + 9, turnedBegin);
-
-  return turned;
-}
-
-static inline array<Cell, 12> doSwapBottom(const array<Cell, 12> &cells) {
-  array<Cell, 12> turned = cells;
-
-  auto cellsBegin = cells.begin();
-  auto turnedBegin = turned.begin();
-  std::copy(cellsBegin + 3, cellsBegin + 6, turnedBegin + 9);
-  std::copy(cellsBegin + 9, cellsBegin + 12, turnedBegin + 3);
-
-  return turned;
-}
-
-static inline array<Cell, 12> doTurnA(const array<Cell, 12> &cells) {
-  array<Cell, 12> turned = cells;
-
-  auto cellsBegin = cells.begin();
-  std::copy(cellsBegin, cellsBegin + 5, turned.begin() + 1);
-  turned[0] = cells[5];
-
-  return turned;
-}
-
-static inline array<Cell, 12> doTurnB(const array<Cell, 12> &cells) {
-  array<Cell, 12> turned = cells;
-
-  auto cellsBegin = cells.begin();
-  std::copy(cellsBegin + 6, cellsBegin + 11, turned.begin() + 7);
-  turned[6] = cells[11];
-
-  return turned;
+Shuriken::Shuriken(const array<Cell, 12> &cells) : packed(0) {
+  for (auto i = 0u; i < cells.size(); ++i) {
+    packed |= uint64_t{cells[i]} << (4 * i);
+  }
 }
 
-static inline array<Cell, 12> doReverseA(const array<Cell, 12> &cells) {
-  array<Cell, 12> turned = cells;
-
-  auto cellsBegin = cells.begin();
-  std::copy(cellsBegin + 1, cellsBegin + 6, turned.begin());
-  turned[5] = cells[0];
-
-  return turned;
+array<Cell, 12> Shuriken::cells() const {
+  array<Cell, 12> result{};
+  for (auto i = 0u; i < result.size(); ++i) {
+    result[i] = static_cast<Cell>((packed >> (4 * i)) & 0xf);
+  }
+  return result;
 }
 
-static inline array<Cell, 12> doReverseB(const array<Cell, 12> &cells) {
-  array<Cell, 12> turned = cells;
-
-  auto cellsBegin = cells.begin();
-  std::copy(cellsBegin + 7, cellsBegin + 12, turned.begin() + 6);
-  turned[11] = cells[6];
+// (11 - i)!, how much each cell's digit weighs in its rank
+static constexpr array<uint32_t, 12> factorials{39916800, 3628800, 362880, 40320, 5040, 720, 120, 24, 6, 2, 1, 1};
 
-  return turned;
-}
+// The Lehmer code of where each cell is, starting from A. Keeping A on side A means its digit, the position itself, is
+// below 6, which is what squeezes the ranks into 6 * 11! = 12! / 2
+uint32_t Shuriken::rank() const {
+  array<uint32_t, 12> positions{};
+  for (uint32_t i = 0; i < 12; ++i) {
+    positions[(packed >> (4 * i)) & 0xf] = i;
+  }
+  if (positions[A] >= 6) {
+    // Flipping it over moves every cell to the other side
+    for (auto &position : positions) {
+      position = (position + 6) % 12;
+    }
+  }
 
-Shuriken Shuriken::apply(Shurikens::Move move) const {
-  switch (move) {
-  case swap_top:
-    return Shuriken(doSwapTop(this->cells));
-  case swap_bottom:
-    return Shuriken(doSwapBottom(this->cells));
-  case turn_a:
-    return Shuriken(doTurnA(this->cells));
-  case turn_b:
-    return Shuriken(doTurnB(this->cells));
-  case reverse_a:
-    return Shuriken(doReverseA(this->cells));
-  case reverse_b:
-    return Shuriken(doReverseB(this->cells));
-  default:
-    ensure_never("Tried to apply an invalid move!");
-    return *this;
+  uint32_t result = 0;
+  uint32_t used = 0;
+  for (size_t cell = 0; cell < 12; ++cell) {
+    auto position = positions[cell];
+    auto digit = position - static_cast<uint32_t>(std::popcount(used & ((1u << position) - 1)));
+    result += digit * factorials[cell];
+    used |= 1u << position;
   }
+  return result;
 }
 
-bool Shuriken::operator==(const Shuriken &other) const {
-  if (cells == other.cells) return true;
-
-  auto us = cells.begin();
-  auto them = other.cells.begin();
-
-  for (auto i = 0; i < 6; ++i) {
-    if (*us != *(them + 6)) return false;
-    if (*(us + 6) != *them) return false;
-
-    ++us, ++them;
+Shuriken Shuriken::unrank(uint32_t rank) {
+  ensure(rank < count);
+
+  uint64_t packed = 0;
+  uint32_t used = 0;
+  for (size_t cell = 0; cell < 12; ++cell) {
+    auto digit = rank / factorials[cell];
+    rank %= factorials[cell];
+
+    // The digit-th position that's still free
+    uint32_t position = 0;
+    for (auto free = ~used;; free &= free - 1) {
+      position = static_cast<uint32_t>(std::countr_zero(free));
+      if (digit-- == 0) break;
+    }
+    used |= 1u << position;
+    packed |= uint64_t{cell} << (4 * position);
   }
-
-  return true;
+  return Shuriken{packed};
 }
@@ -23,7 +23,9 @@
 #pragma once
 
 #include "common/arbitrary_container.h"
+#include "common/assertions.h"
 
+#include <algorithm>
 #include <array>
 #include <cstdint>
 #include <functional>
@@ -36,17 +38,72 @@ enum Cell : uint8_t { A, B, C, D, E, F, G, H, I, J, K, L };
 const std::array<Move, 6> allMoves = {swap_top, swap_bottom, turn_a, turn_b, reverse_a, reverse_b};
 typedef Puzzles::ArbitraryContainer<allMoves.size()> MoveContainer;
 
+// Every cell fits in a nibble, so the whole shuriken is packed into the lowest 48 bits of a single word, cell i in bits
+// 4i to 4i + 3. Side A is the lower 24 bits and side B the upper ones, which turns every move into a few shifts and
+// masks
 class Shuriken {
 public:
-  explicit Shuriken(std::array<Cell, 12> cells) : cells(cells) {}
+  explicit Shuriken(const std::array<Cell, 12> &cells);
 
-  Shuriken apply(Move move) const;
+  inline Shuriken apply(Move move) const {
+    switch (move) {
+    case swap_top:
+      return Shuriken{swapSides(packed, 0x000fff)};
+    case swap_bottom:
+      return Shuriken{swapSides(packed, 0xfff000)};
+    case turn_a:
+      return Shuriken{(packed & ~sideMask) | rotateSide(packed & sideMask, 4)};
+    case turn_b:
+      return Shuriken{(packed & sideMask) | rotateSide(packed >> 24, 4) << 24};
+    case reverse_a:
+      return Shuriken{(packed & ~sideMask) | rotateSide(packed & sideMask, 20)};
+    case reverse_b:
+      return Shuriken{(packed & sideMask) | rotateSide(packed >> 24, 20) << 24};
+    default:
+      ensure_never("Tried to apply an invalid move!");
+      return *this;
+    }
+  }
+
+  inline bool isSolved() const { return *this == Shuriken{solved}; }
+
+  // How many different shurikens there are, 12! / 2 since flipping one over doesn't count
+  static constexpr uint32_t count = 239500800;
+
+  // A different number in [0, count) for every shuriken, the same for both sides up
+  uint32_t rank() const;
+  // The shuriken with that rank, with A somewhere on side A
+  static Shuriken unrank(uint32_t rank);
+
+  std::array<Cell, 12> cells() const;
+  // Flipping a shuriken over doesn't make it a different one, so this is the same for both sides up
+  inline uint64_t canonical() const { return std::min(packed, flipped(packed)); }
+
+  inline bool operator==(const Shuriken &other) const {
+    return packed == other.packed || packed == flipped(other.packed);
+  }
 
-  inline bool isSolved() const { return *this == Shuriken({A, B, C, D, E, F, G, H, I, J, K, L}); }
+private:
+  static constexpr uint64_t sideMask = 0xffffff;
+  // A, B, C, D, E, F, G, H, I, J, K, L
+  static constexpr uint64_t solved = 0xba9876543210;
 
-  bool operator==(const Shuriken &other) const;
+  explicit constexpr Shuriken(uint64_t packed) : packed(packed) {}
 
-  const std::array<Cell, 12> cells;
+  // Trades the cells in `mask` from side A with the same ones from side B
+  static constexpr uint64_t swapSides(uint64_t value, uint64_t mask) {
+    auto difference = (value ^ (value >> 24)) & mask;
+    return value ^ difference ^ (difference << 24);
+  }
+
+  // Rotates the 24 bits of a side to the left
+  static constexpr uint64_t rotateSide(uint64_t side, int bits) {
+    return ((side << bits) | (side >> (24 - bits))) & sideMask;
+  }
+
+  static constexpr uint64_t flipped(uint64_t value) { return (value >> 24) | ((value & sideMask) << 24); }
+
+  uint64_t packed;
 };
 }
 
@@ -54,15 +111,11 @@ namespace std {
 template <>
 struct hash<Shurikens::Shuriken> {
   std::size_t operator()(const Shurikens::Shuriken &shuriken) const {
-    size_t first = 0;
-    size_t second = 0;
-
-    for (auto i = 0u; i < 6; ++i) {
-      first = (first * 31) + hash<int>()(shuriken.cells[i]);
-      second = (second * 31) + hash<int>()(shuriken.cells[i + 6]);
-    }
-
-    return first * second;
+    // The finalizer from MurmurHash3, since the canonical state itself is far too regular to be used as it is
+    auto value = shuriken.canonical();
+    value = (value ^ (value >> 33)) * 0xff51afd7ed558ccd;
+    value = (value ^ (value >> 33)) * 0xc4ceb9fe1a85ec53;
+    return value ^ (value >> 33);
   }
 };
 }
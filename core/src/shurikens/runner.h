@@ -25,4 +25,5 @@
 namespace Shurikens {
 
 bool run(bool fullRun);
+bool runBenchmarks();
 }
@@ -22,60 +22,106 @@
 
 #include "breadth_search_solver.h"
 
-#include "common/numbers.h"
-
-#include <cmath>
+#include <cstdlib>
+#include <memory>
 #include <queue>
-#include <unordered_set>
-#include <utility>
+#include <vector>
 
-using namespace Puzzles;
 using namespace Shurikens;
 
 using std::queue;
-using std::unordered_set;
-using std::vector;
 
 namespace {
-struct Node {
-  const Shuriken shuriken;
-  const MoveContainer moves;
 
-  explicit Node(Shuriken shuriken) : shuriken(std::move(shuriken)), moves() {}
-  Node(Shuriken shuriken, MoveContainer moves) : shuriken(std::move(shuriken)), moves(std::move(moves)) {}
+// Every other value is the move that reached a shuriken, plus one
+constexpr uint8_t unseen = 0, start = 7;
+
+// Which move first reached every shuriken, a nibble each and indexed by rank, so nodes don't have to carry the moves
+// that led to them. Following those back from the solution gives the exact same answer as if they had.
+// That's 12! / 4 bytes, twice the 12! / 8 of keeping only depths modulo 3 in two bits. Those are enough to walk back
+// along *a* shortest solution, but not necessarily the one breadth first search found first: for real1 it walks back a
+// different 21 move solution than the two its data accepts, so don't shrink this into one
+struct MoveTable {
+  // calloc leaves the zeroing up to the OS, so small searches only pay for the few pages they actually touch
+  MoveTable() : nibbles(static_cast<uint8_t *>(std::calloc(Shuriken::count / 2, 1)), &std::free) {
+    // Release builds have no exceptions to throw, so this does what a failed new would there
+    if (!nibbles) std::abort();
+  }
+
+  inline uint8_t operator[](const Shuriken &shuriken) const {
+    auto rank = shuriken.rank();
+    return (nibbles[rank / 2] >> (rank % 2 * 4)) & 0xf;
+  }
+
+  // Records how a shuriken was reached, unless it already had been
+  inline bool insert(const Shuriken &shuriken, uint8_t value) {
+    auto rank = shuriken.rank();
+    auto &byte = nibbles[rank / 2];
+    auto shift = rank % 2 * 4;
+    if (((byte >> shift) & 0xf) != unseen) return false;
+
+    byte = static_cast<uint8_t>(byte | (value << shift));
+    return true;
+  }
+
+private:
+  std::unique_ptr<uint8_t[], decltype(&std::free)> nibbles;
 };
+
+constexpr Move inverse(Move move) {
+  switch (move) {
+  case turn_a:
+    return reverse_a;
+  case turn_b:
+    return reverse_b;
+  case reverse_a:
+    return turn_a;
+  case reverse_b:
+    return turn_b;
+  default:
+    return move;
+  }
 }
 
-MoveContainer BreadthSearchSolver::solve(const Shuriken &shuriken, size_t knownUpperBound) const {
-  if (shuriken.isSolved()) return {};
+MoveContainer traceBack(const MoveTable &table, Shuriken shuriken) {
+  std::vector<Move> moves;
+  for (auto value = table[shuriken]; value != start; value = table[shuriken]) {
+    auto move = static_cast<Move>(value - 1);
+    moves.push_back(move);
+    shuriken = shuriken.apply(inverse(move));
+  }
+
+  MoveContainer result;
+  result.reserve(moves.size());
+  for (auto it = moves.crbegin(); it != moves.crend(); ++it) {
+    result.push(*it);
+  }
+  return result;
+}
+}
 
-  auto maxNodes = static_cast<size_t>(std::pow(allMoves.size(), knownUpperBound) + 1);
-  auto maxShurikens = static_cast<size_t>(std::ceil(Numbers::factorial(12) / 2));
+MoveContainer BreadthSearchSolver::solve(const Shuriken &shuriken, size_t) const {
+  if (shuriken.isSolved()) return {};
 
-  unordered_set<Shuriken> cache;
-  cache.reserve(std::min(maxNodes, maxShurikens));
-  cache.insert(shuriken);
+  MoveTable table;
+  table.insert(shuriken, start);
 
-  queue<Node> nodes;
-  nodes.emplace(shuriken);
+  queue<Shuriken> nodes;
+  nodes.push(shuriken);
 
   do {
     auto next = nodes.front();
     nodes.pop();
 
     for (auto &move : allMoves) {
-      auto newShuriken = next.shuriken.apply(move);
-
-      if (cache.insert(newShuriken).second) {
-        MoveContainer newMoves(next.moves);
-        newMoves.push(move);
-        newMoves.shrink_to_fit();
+      auto newShuriken = next.apply(move);
 
+      if (table.insert(newShuriken, static_cast<uint8_t>(move + 1))) {
         if (newShuriken.isSolved()) {
-          return newMoves;
+          return traceBack(table, newShuriken);
         }
 
-        nodes.emplace(newShuriken, newMoves);
+        nodes.push(newShuriken);
       }
     }
   } while (!nodes.empty());
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "common/coroutines.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#if defined(__cpp_impl_coroutine)
+
+using namespace Puzzles;
+
+LazySequence<int> upTo(int limit) {
+  for (auto i = 0; i < limit; ++i) {
+    co_yield i;
+  }
+}
+
+TEST(LazySequence, Finite) {
+  std::vector<int> values;
+  auto sequence = upTo(4);
+  for (auto value : sequence) {
+    values.push_back(value);
+  }
+  EXPECT_EQ(values, (std::vector<int>{0, 1, 2, 3}));
+}
+
+TEST(LazySequence, Empty) {
+  auto sequence = upTo(0);
+  EXPECT_FALSE(sequence.begin() != sequence.end());
+}
+
+TEST(LazySequence, SkippingValues) {
+  auto sequence = upTo(3);
+  auto it = sequence.begin();
+
+  // Going forward without ever looking at a value still skips it
+  ++it;
+  EXPECT_EQ(*it, 1);
+  ++it;
+  EXPECT_TRUE(it != sequence.end());
+  ++it;
+  EXPECT_FALSE(it != sequence.end());
+}
+
+#endif // defined(__cpp_impl_coroutine)
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2026 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "common/numbers/fixed_integer.h"
+#include "common/numbers/integer.h"
+#include "common/numbers/integers.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+using pzl::FixedInteger;
+using pzl::Integer;
+
+using Fixed = FixedInteger<256>;
+
+TEST(FixedInteger, CreateAndPrint) {
+  EXPECT_EQ(Fixed{0}.toString(), "0");
+  EXPECT_EQ(Fixed{-1}.toString(), "-1");
+  EXPECT_EQ(Fixed{INTMAX_MIN}.toString(), std::to_string(INTMAX_MIN));
+  EXPECT_EQ(Fixed{"-0"}, Fixed{0});
+  EXPECT_EQ(Fixed{"10000000000000000000"}.toString(), "10000000000000000000");
+  EXPECT_EQ(Fixed{"100000000000000000000000000000000000000"}.toString(), "100000000000000000000000000000000000000");
+
+  // 2^256 - 1 is the biggest value it can hold
+  auto biggest = "115792089237316195423570985008687907853269984665640564039457584007913129639935";
+  EXPECT_EQ(Fixed{biggest}.toString(), biggest);
+  EXPECT_EQ(Fixed{biggest}.bitLength(), 256);
+  EXPECT_EQ(Fixed{0}.bitLength(), 0);
+}
+
+TEST(FixedInteger, Constexpr) {
+  constexpr auto value = Fixed{3}.power(Fixed{150}) / Fixed{3}.power(Fixed{148}) - Fixed{10};
+  static_assert(value == -1);
+  static_assert(Fixed{-7}.divmod(Fixed{2}).second == -1);
+  static_assert(greatestCommonDivisor(Fixed{3154}, Fixed{4522}) == 38);
+}
+
+TEST(FixedInteger, Overflow) {
+  auto biggest = Fixed{2}.power(Fixed{255}) - 1 + Fixed{2}.power(Fixed{255});
+
+  EXPECT_FALSE(biggest.checkedAdd(Fixed{1}).has_value());
+  EXPECT_FALSE(biggest.checkedSubtract(Fixed{-1}).has_value());
+  EXPECT_FALSE(biggest.checkedMultiply(Fixed{2}).has_value());
+  EXPECT_FALSE(Fixed{2}.power(Fixed{128}).checkedMultiply(Fixed{2}.power(Fixed{128})).has_value());
+
+  EXPECT_EQ(biggest.checkedAdd(Fixed{-1}), biggest - 1);
+  EXPECT_EQ(biggest.checkedSubtract(biggest), Fixed{0});
+  EXPECT_EQ(Fixed{2}.power(Fixed{127}).checkedMultiply(Fixed{2}.power(Fixed{128}) * -1),
+            Fixed{2}.power(Fixed{255}) * -1);
+}
+
+TEST(FixedInteger, MatchesInteger) {
+  std::mt19937 random{42};
+  std::uniform_int_distribution<int> digit{0, 9};
+  std::uniform_int_distribution<int> length{1, 38};
+
+  auto randomDigits = [&]() {
+    std::string value(static_cast<size_t>(length(random)), '0');
+    for (auto &c : value) {
+      c = static_cast<char>('0' + digit(random));
+    }
+    if (digit(random) < 5) value = "-" + value;
+    return value;
+  };
+
+  for (auto i = 0; i < 2000; ++i) {
+    auto left = randomDigits(), right = randomDigits();
+    Fixed fixedLeft{left}, fixedRight{right};
+    Integer integerLeft{left}, integerRight{right};
+
+    EXPECT_EQ((fixedLeft + fixedRight).toString(), (integerLeft + integerRight).toString());
+    EXPECT_EQ((fixedLeft - fixedRight).toString(), (integerLeft - integerRight).toString());
+    EXPECT_EQ((fixedLeft * fixedRight).toString(), (integerLeft * integerRight).toString());
+    EXPECT_EQ(fixedLeft < fixedRight, integerLeft < integerRight);
+    EXPECT_EQ(fixedLeft == fixedRight, integerLeft == integerRight);
+    EXPECT_EQ(greatestCommonDivisor(fixedLeft, fixedRight).toString(),
+              greatestCommonDivisor(integerLeft, integerRight).toString());
+
+    if (fixedRight != 0) {
+      auto [quotient, remainder] = fixedLeft.divmod(fixedRight);
+      auto [integerQuotient, integerRemainder] = integerLeft.divmod(integerRight);
+      EXPECT_EQ(quotient.toString(), integerQuotient.toString());
+      EXPECT_EQ(remainder.toString(), integerRemainder.toString());
+    }
+  }
+}
+
+TEST(FixedInteger, Division_AddBack) {
+  // These make long division's first estimate too big, so it has to add the divisor back
+  std::vector<std::pair<std::string, std::string>> cases{
+      {"340282366920938463463374607431768211455", "18446744073709551617"},
+      {"6277101735386680763835789423207666416102355444464034512895", "340282366920938463444927863358058659840"},
+      {"115792089237316195423570985008687907853269984665640564039457584007913129639935",
+       "340282366920938463463374607431768211457"},
+  };
+
+  for (const auto &[dividend, divisor] : cases) {
+    auto [quotient, remainder] = Fixed{dividend}.divmod(Fixed{divisor});
+    auto [integerQuotient, integerRemainder] = Integer{dividend}.divmod(Integer{divisor});
+    EXPECT_EQ(quotient.toString(), integerQuotient.toString());
+    EXPECT_EQ(remainder.toString(), integerRemainder.toString());
+  }
+}
+
+TEST(FixedInteger, GreatestCommonDivisor_Big) {
+  // Consecutive Fibonacci numbers are Euclid's worst case, and gcd(F(m), F(n)) = F(gcd(m, n))
+  using Wide = FixedInteger<768>;
+  std::vector<Wide> fibonacci{Wide{0}, Wide{1}};
+  while (fibonacci.size() <= 1000) {
+    fibonacci.push_back(fibonacci[fibonacci.size() - 1] + fibonacci[fibonacci.size() - 2]);
+  }
+
+  EXPECT_EQ(greatestCommonDivisor(fibonacci[1000], fibonacci[999]), Wide{1});
+  EXPECT_EQ(greatestCommonDivisor(fibonacci[1000], fibonacci[750]), fibonacci[250]);
+  EXPECT_EQ(greatestCommonDivisor(fibonacci[960], fibonacci[1000]), fibonacci[40]);
+  EXPECT_EQ(greatestCommonDivisor(fibonacci[999], fibonacci[666] * -1), fibonacci[333]);
+}
+
+TEST(FixedInteger, Bits) {
+  std::vector<int64_t> values{0, 1, -1, 5, -5, 12345678901, -12345678901, INT64_MAX, INT64_MIN};
+  for (auto left : values) {
+    for (auto right : values) {
+      EXPECT_EQ(Fixed{left} & Fixed{right}, Fixed{left & right});
+      EXPECT_EQ(Fixed{left} | Fixed{right}, Fixed{left | right});
+      EXPECT_EQ(Fixed{left} ^ Fixed{right}, Fixed{left ^ right});
+    }
+    for (size_t bit = 0; bit < 64; ++bit) {
+      EXPECT_EQ(Fixed{left}.testBit(bit), ((static_cast<uint64_t>(left) >> bit) & 1) != 0);
+    }
+
+    for (size_t bits : {0u, 1u, 63u, 64u, 65u, 150u}) {
+      EXPECT_EQ((Fixed{left} << bits).toString(), (Integer{left} << bits).toString());
+      EXPECT_EQ((Fixed{left} >> bits).toString(), (Integer{left} >> bits).toString());
+    }
+  }
+
+  EXPECT_FALSE(Fixed{1}.checkedShiftLeft(256).has_value());
+  EXPECT_EQ(Fixed{1}.checkedShiftLeft(255), Fixed{2}.power(Fixed{255}));
+}
+
+TEST(FixedInteger, PowMod) {
+  EXPECT_EQ(Fixed{3}.powMod(Fixed{1000}, Fixed{1000007}).toString(),
+            Integer{3}.powMod(Integer{1000}, Integer{1000007}).toString());
+  EXPECT_EQ(Fixed{-3}.powMod(Fixed{1001}, Fixed{-1000007}).toString(),
+            Integer{-3}.powMod(Integer{1001}, Integer{-1000007}).toString());
+
+  // The modulus is close to the limit, so the products only fit in the wider type
+  auto modulus = "115792089237316195423570985008687907853269984665640564039457584007913129639747";
+  EXPECT_EQ(Fixed{2}.powMod(Fixed{modulus} - 1, Fixed{modulus}), Fixed{1});
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "common/numbers/integer.h"
+#include "common/numbers/rational.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib> // std::malloc, std::free, std::abort
+#include <new>     // operator new
+
+using pzl::Integer;
+using pzl::Rational;
+
+// This test has its own executable, so we can count every allocation it makes
+namespace {
+size_t allocations = 0;
+
+template <typename Operation>
+size_t countAllocations(const Operation &operation) {
+  auto before = allocations;
+  operation();
+  return allocations - before;
+}
+}
+
+void *operator new(size_t size) {
+  ++allocations;
+  auto pointer = std::malloc(size);
+  if (pointer == nullptr) std::abort();
+  return pointer;
+}
+
+void operator delete(void *pointer) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void *pointer, size_t) noexcept {
+  std::free(pointer);
+}
+
+TEST(Integer_Allocations, SmallValuesStayInline) {
+  const std::string maxUnsigned{"18446744073709551615"};
+
+  EXPECT_EQ(countAllocations([] { return Integer{0}; }), 0);
+  EXPECT_EQ(countAllocations([] { return Integer{1}; }), 0);
+  EXPECT_EQ(countAllocations([] { return Integer{-1}; }), 0);
+  EXPECT_EQ(countAllocations([] { return Integer{std::numeric_limits<intmax_t>::max()}; }), 0);
+  EXPECT_EQ(countAllocations([&maxUnsigned] { return Integer{maxUnsigned}; }), 0);
+}
+
+TEST(Integer_Allocations, ComparisonsDoNotAllocate) {
+  Integer value{123456789012345};
+
+  EXPECT_EQ(countAllocations([&value] { return value == 1; }), 0);
+  EXPECT_EQ(countAllocations([&value] { return value != 1; }), 0);
+  EXPECT_EQ(countAllocations([&value] { return value < 1; }), 0);
+  EXPECT_EQ(countAllocations([&value] { return value <= 1; }), 0);
+  EXPECT_EQ(countAllocations([&value] { return value > 1; }), 0);
+  EXPECT_EQ(countAllocations([&value] { return value < Integer{-1}; }), 0);
+}
+
+TEST(Integer_Allocations, SmallArithmeticDoesNotAllocate) {
+  Integer left{987654321}, right{123456789};
+
+  EXPECT_EQ(countAllocations([&left, &right] { return left + right; }), 0);
+  EXPECT_EQ(countAllocations([&left, &right] { return left - right; }), 0);
+  EXPECT_EQ(countAllocations([&left, &right] { return left * right; }), 0);
+  EXPECT_EQ(countAllocations([&left, &right] { return left / right; }), 0);
+  EXPECT_EQ(countAllocations([&left, &right] { return left % right; }), 0);
+  EXPECT_EQ(countAllocations([&left] { return left + 1; }), 0);
+  EXPECT_EQ(countAllocations([&left] { return left * 2; }), 0);
+  EXPECT_EQ(countAllocations([&left] { return ++left; }), 0);
+}
+
+TEST(Integer_Allocations, BigValuesGoToTheHeap) {
+  EXPECT_GT(countAllocations([] { return Integer{"1354645611354413541715318441313195999999999"}; }), 0);
+}
+
+TEST(Integer_Allocations, InPlaceArithmeticReusesStorage) {
+  Integer value{"100000000000000000000000000000000000000000"};
+  Integer other{"99999999999999999999999999999999999999"};
+
+  EXPECT_EQ(countAllocations([&value, &other] { value += other; }), 0);
+  EXPECT_EQ(countAllocations([&value, &other] { value -= other; }), 0);
+  EXPECT_EQ(countAllocations([&value] { value += 123456789; }), 0);
+  EXPECT_EQ(countAllocations([&value] { value -= 123456789; }), 0);
+  EXPECT_EQ(countAllocations([&value] { value *= 7; }), 0);
+  EXPECT_EQ(countAllocations([&value] { ++value; }), 0);
+}
+
+TEST(Integer_Allocations, TemporariesAreReused) {
+  Integer value{"100000000000000000000000000000000000000000"};
+  Integer other{"99999999999999999999999999999999999999"};
+
+  // Copying the left operand is the only allocation left
+  EXPECT_EQ(countAllocations([&value, &other] { return Integer{value} + other; }), 1);
+  EXPECT_EQ(countAllocations([&value, &other] { return Integer{value} - other - other - other; }), 1);
+  EXPECT_EQ(countAllocations([&value, &other] { return Integer{value} * 3 + other - 1; }), 1);
+}
+
+TEST(Integer_Allocations, RationalArithmetic) {
+  // Word-sized numerators and denominators never touch the heap
+  EXPECT_EQ(countAllocations([] { return Rational{1, 6} + Rational{1, 10}; }), 0);
+  EXPECT_EQ(countAllocations([] { return Rational{1, 6} - Rational{1, 10}; }), 0);
+  EXPECT_EQ(countAllocations([] { return Rational{4, 6} * Rational{3, 10}; }), 0);
+  EXPECT_EQ(countAllocations([] { return Rational{4, 6} / Rational{-3, 10}; }), 0);
+  EXPECT_EQ(countAllocations([] { return std::pow(Rational{2, 3}, Rational{30}); }), 0);
+  EXPECT_EQ(countAllocations([] { return Rational{1, 6} == Rational{2, 12}; }), 0);
+
+  // Cross-multiplying word-sized values stays inline too
+  Rational left{std::numeric_limits<intmax_t>::max() - 1, std::numeric_limits<intmax_t>::max()};
+  Rational right{std::numeric_limits<intmax_t>::max() - 2, std::numeric_limits<intmax_t>::max() - 1};
+  EXPECT_EQ(countAllocations([&left, &right] { return left < right; }), 0);
+  EXPECT_EQ(countAllocations([&left, &right] { return right < left; }), 0);
+  EXPECT_EQ(countAllocations([&left] { return left < Rational{1}; }), 0);
+
+  // Big ones still allocate, mostly inside greatestCommonDivisor and the divisions
+  Rational sum{0};
+  auto allocations = countAllocations([&sum] {
+    for (auto i = 1; i <= 100; ++i) {
+      sum += Rational{1, i};
+    }
+  });
+  EXPECT_EQ(std::to_string(sum), "14466636279520351160221518043104131447711/2788815009188499086581352357412492142272");
+  EXPECT_LE(allocations, 1200); // Copying every intermediate value used to take around 2200
+}
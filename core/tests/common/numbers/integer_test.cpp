@@ -24,6 +24,9 @@
 
 #include <gtest/gtest.h>
 
+#include <utility>
+#include <vector>
+
 using pzl::Integer;
 
 TEST(Integer, CreateFromString) {
@@ -35,6 +38,29 @@ TEST(Integer, CreateFromString) {
   EXPECT_EQ(std::to_string(Integer{"1354645611354413541715318441313195"}), "1354645611354413541715318441313195");
 }
 
+TEST(Integer, CreateFromString_Big) {
+  // Long enough to go through the divide and conquer conversions, with some runs of zeroes in the middle
+  std::string digits;
+  for (auto i = 1; digits.length() < 20000; ++i) {
+    digits += std::to_string(i * 7919 % 1000003);
+    if (i % 50 == 0) digits += std::string(static_cast<size_t>(i % 37), '0');
+  }
+
+  for (auto length : {600, 1151, 1152, 1153, 4608, 10000, 20000}) {
+    auto prefix = digits.substr(0, static_cast<size_t>(length));
+    EXPECT_EQ(std::to_string(Integer{prefix}), prefix);
+    EXPECT_EQ(std::to_string(Integer{"-" + prefix}), "-" + prefix);
+  }
+
+  for (auto exponent : {576, 1151, 1152, 1153, 4608, 9999}) {
+    auto power = Integer{10}.power(Integer{exponent});
+    auto expected = "1" + std::string(static_cast<size_t>(exponent), '0');
+    EXPECT_EQ(std::to_string(power), expected);
+    EXPECT_EQ(Integer{expected}, power);
+    EXPECT_EQ(std::to_string(power - 1), std::string(static_cast<size_t>(exponent), '9'));
+  }
+}
+
 TEST(Integer, CreateFromInt) {
   EXPECT_EQ(std::to_string(Integer{-1}), "-1");
   EXPECT_EQ(std::to_string(Integer{0}), "0");
@@ -55,6 +81,30 @@ TEST(Integer, CreateFromInt) {
 
   constexpr intmax_t max = std::numeric_limits<intmax_t>::max();
   EXPECT_EQ(std::to_string(Integer{max}), std::to_string(max));
+
+  constexpr intmax_t min = std::numeric_limits<intmax_t>::min();
+  EXPECT_EQ(std::to_string(Integer{min}), std::to_string(min));
+}
+
+TEST(Integer, SliceBoundaries) {
+  Integer twoToThe32{"4294967296"};
+  Integer twoToThe64{"18446744073709551616"};
+
+  EXPECT_EQ(std::to_string(Integer{4294967295} + 1), "4294967296");
+  EXPECT_EQ(std::to_string(twoToThe32 - 1), "4294967295");
+  EXPECT_EQ(std::to_string(twoToThe32 * twoToThe32), "18446744073709551616");
+  EXPECT_EQ(std::to_string(twoToThe64 - 1), "18446744073709551615");
+  EXPECT_EQ(std::to_string(twoToThe64 / twoToThe32), "4294967296");
+  EXPECT_EQ(std::to_string((twoToThe64 - 1) % twoToThe32), "4294967295");
+  EXPECT_EQ(twoToThe32 * twoToThe32, twoToThe64);
+
+  Integer decrementing{"-4294967296"};
+  ++decrementing;
+  EXPECT_EQ(decrementing, Integer{-4294967295});
+
+  // Leading zeroes in every decimal chunk
+  EXPECT_EQ(std::to_string(Integer{"1000000000000000000000000000001"}), "1000000000000000000000000000001");
+  EXPECT_EQ(std::to_string(Integer{"-1000000000000000000"}), "-1000000000000000000");
 }
 
 TEST(Integer, Addition) {
@@ -216,6 +266,88 @@ TEST(Integer, Multiplication) {
   EXPECT_EQ(std::to_string(two * negativeOne), "-2");
 }
 
+TEST(Integer, Multiplication_Big) {
+  Integer nines{"99999999999999999999"};
+  Integer absurdIntegerOne{"1354645611354413541715318441313195"};
+  Integer absurdIntegerTwo{"-137415147537554114372745478463741"};
+
+  EXPECT_EQ(std::to_string(nines * nines), "9999999999999999999800000000000000000001");
+  EXPECT_EQ(std::to_string(absurdIntegerOne * absurdIntegerTwo),
+            "-186148826545366927834149253724351422384096937312335307275232362495");
+}
+
+TEST(Integer, Multiplication_KaratsubaMatchesSchoolbook) {
+  const auto defaultThreshold = Integer::karatsubaThreshold;
+  const auto defaultToomCookThreshold = Integer::toomCookThreshold;
+  const auto defaultNttThreshold = Integer::nttThreshold;
+
+  std::string leftDigits, rightDigits;
+  for (auto i = 0; i < 1000; ++i) {
+    leftDigits += std::to_string((i * 7919) % 1000000007);
+    rightDigits += std::to_string((i * 104729) % 999999937);
+  }
+  Integer left{leftDigits}, right{rightDigits}, shortRight{rightDigits.substr(0, 300)};
+
+  Integer::karatsubaThreshold = std::numeric_limits<size_t>::max();
+  auto expected = left * right;
+  auto expectedUnbalanced = left * shortRight;
+
+  Integer::karatsubaThreshold = 2;
+  Integer::toomCookThreshold = std::numeric_limits<size_t>::max();
+  Integer::nttThreshold = std::numeric_limits<size_t>::max();
+  EXPECT_EQ(left * right, expected);
+  EXPECT_EQ(right * left, expected);
+  EXPECT_EQ(left * shortRight, expectedUnbalanced);
+  EXPECT_EQ(shortRight * left, expectedUnbalanced);
+
+  Integer::karatsubaThreshold = defaultThreshold;
+  Integer::toomCookThreshold = defaultToomCookThreshold;
+  Integer::nttThreshold = defaultNttThreshold;
+  EXPECT_EQ(left * right, expected);
+  EXPECT_EQ(left * shortRight, expectedUnbalanced);
+}
+
+TEST(Integer, Multiplication_FastAlgorithmsMatchSchoolbook) {
+  const auto defaultKaratsubaThreshold = Integer::karatsubaThreshold;
+  const auto defaultToomCookThreshold = Integer::toomCookThreshold;
+  const auto defaultNttThreshold = Integer::nttThreshold;
+
+  std::string leftDigits, rightDigits;
+  for (auto i = 0; i < 1000; ++i) {
+    leftDigits += std::to_string((i * 7919) % 1000000007);
+    rightDigits += std::to_string((i * 104729) % 999999937);
+  }
+  // All ones in binary, so every partial product and every carry is as big as it can be
+  auto allOnes = Integer{2}.power(Integer{20000}) - Integer{1};
+  std::vector<std::pair<Integer, Integer>> operands{
+      {Integer{leftDigits}, Integer{rightDigits}},
+      {Integer{leftDigits}, Integer{rightDigits.substr(0, 300)}},
+      {Integer{leftDigits}, Integer{"-" + rightDigits.substr(0, 2000)}},
+      {allOnes, allOnes},
+      {allOnes, Integer{2}.power(Integer{9000}) - Integer{1}},
+  };
+
+  for (const auto &[left, right] : operands) {
+    Integer::karatsubaThreshold = std::numeric_limits<size_t>::max();
+    auto expected = left * right;
+
+    Integer::karatsubaThreshold = 2;
+    Integer::toomCookThreshold = 3;
+    Integer::nttThreshold = std::numeric_limits<size_t>::max();
+    EXPECT_EQ(left * right, expected);
+    EXPECT_EQ(right * left, expected);
+
+    Integer::nttThreshold = 2;
+    EXPECT_EQ(left * right, expected);
+    EXPECT_EQ(right * left, expected);
+
+    Integer::karatsubaThreshold = defaultKaratsubaThreshold;
+    Integer::toomCookThreshold = defaultToomCookThreshold;
+    Integer::nttThreshold = defaultNttThreshold;
+    EXPECT_EQ(left * right, expected);
+  }
+}
+
 TEST(Integer, Division) {
   Integer negativeOne{-1};
   Integer one{1};
@@ -237,6 +369,111 @@ TEST(Integer, Division) {
   EXPECT_EQ(std::to_string(two / negativeOne), "-2");
 }
 
+TEST(Integer, Division_Big) {
+  Integer absurdIntegerOne{"1354645611354413541715318441313195"};
+  Integer absurdIntegerTwo{"137415147537554114372745478463741"};
+  Integer almostPowerOfTen{"10000000000000000000000000000000000000012345"};
+  Integer almostSliceSizeSquared{"999999999999999999"};
+
+  EXPECT_EQ(std::to_string(absurdIntegerOne / absurdIntegerTwo), "9");
+  EXPECT_EQ(std::to_string(absurdIntegerTwo / absurdIntegerOne), "0");
+  EXPECT_EQ(std::to_string(almostPowerOfTen / almostSliceSizeSquared), "10000000000000000010000000");
+  EXPECT_EQ(std::to_string(almostPowerOfTen % almostSliceSizeSquared), "10012345");
+}
+
+TEST(Integer, Division_NewtonMatchesLongDivision) {
+  const auto defaultKaratsubaThreshold = Integer::karatsubaThreshold;
+  const auto defaultNewtonThreshold = Integer::newtonDivisionThreshold;
+
+  std::string dividendDigits, divisorDigits;
+  for (auto i = 0; i < 500; ++i) {
+    dividendDigits += std::to_string((i * 7919) % 1000000007);
+    divisorDigits += std::to_string((i * 104729) % 999999937);
+  }
+  Integer dividend{dividendDigits};
+  std::vector<Integer> divisors{Integer{divisorDigits.substr(0, 1500)}, Integer{divisorDigits.substr(0, 700)},
+                                Integer{divisorDigits.substr(0, 100)}, Integer{"4294967296"}.power(Integer{40}),
+                                Integer{"4294967295"}.power(Integer{40}), Integer{3}.power(Integer{500})};
+
+  for (const auto &divisor : divisors) {
+    Integer::newtonDivisionThreshold = std::numeric_limits<size_t>::max();
+    auto expected = dividend.divmod(divisor);
+
+    Integer::newtonDivisionThreshold = 2;
+    Integer::karatsubaThreshold = 4; // So the reciprocals also go through Newton's method
+    auto actual = dividend.divmod(divisor);
+    EXPECT_EQ(actual.first, expected.first);
+    EXPECT_EQ(actual.second, expected.second);
+    EXPECT_EQ(actual.first * divisor + actual.second, dividend);
+
+    Integer::karatsubaThreshold = defaultKaratsubaThreshold;
+    Integer::newtonDivisionThreshold = defaultNewtonThreshold;
+  }
+}
+
+TEST(Integer, Division_NewtonAtDefaultThreshold) {
+  // Both the divisor and the quotient take more than the default 768 slices, so this goes through Newton's reciprocals
+  // with every multiplication threshold left as it is
+  auto divisor = Integer{3}.power(Integer{18000}) + 12345;
+  auto dividend = Integer{7}.power(Integer{20000}) - 67890;
+  ASSERT_GT(divisor.bitLength(), 768 * 32);
+  ASSERT_GT(dividend.bitLength() - divisor.bitLength(), 768 * 32);
+
+  auto [quotient, remainder] = dividend.divmod(divisor);
+  EXPECT_EQ(quotient * divisor + remainder, dividend);
+  EXPECT_GE(remainder, Integer{0});
+  EXPECT_LT(remainder, divisor);
+}
+
+TEST(Integer, DivMod) {
+  auto expectDivMod = [](const Integer &dividend, const Integer &divisor, const std::string &quotient,
+                         const std::string &remainder) {
+    auto [actualQuotient, actualRemainder] = dividend.divmod(divisor);
+    EXPECT_EQ(std::to_string(actualQuotient), quotient);
+    EXPECT_EQ(std::to_string(actualRemainder), remainder);
+  };
+
+  expectDivMod(Integer{0}, Integer{5}, "0", "0");
+  expectDivMod(Integer{7}, Integer{2}, "3", "1");
+  expectDivMod(Integer{-7}, Integer{2}, "-3", "-1");
+  expectDivMod(Integer{7}, Integer{-2}, "-3", "1");
+  expectDivMod(Integer{-7}, Integer{-2}, "3", "-1");
+  expectDivMod(Integer{1}, Integer{2}, "0", "1");
+  expectDivMod(Integer{"1354645611354413541715318441313195"}, Integer{"-137415147537554114372745478463741"}, "-9",
+               "117909283516426512360609135139526");
+}
+
+TEST(Integer, DivMod_Consistency) {
+  std::string dividendDigits, divisorDigits;
+  for (auto i = 1; i < 150; ++i) {
+    dividendDigits += std::to_string((i * 7919) % 1000000007);
+    if (i % 2 == 0) divisorDigits += std::to_string((i * 104729) % 999999937);
+
+    Integer dividend{dividendDigits}, divisor{divisorDigits.empty() ? "7" : divisorDigits};
+    auto [quotient, remainder] = dividend.divmod(divisor);
+
+    EXPECT_EQ(quotient * divisor + remainder, dividend) << dividendDigits << " / " << divisorDigits;
+    EXPECT_TRUE(!(remainder < 0) && remainder < divisor) << dividendDigits << " % " << divisorDigits;
+  }
+}
+
+TEST(Integer, DivMod_AddBack) {
+  // These are the cases where Knuth's quotient estimate is too big and has to be corrected
+  Integer twoToThe32{"4294967296"};
+  Integer divisor = twoToThe32 * twoToThe32 - twoToThe32 + 1;
+  for (auto multiplier : {Integer{"4294967295"}, Integer{"4294967294"}, Integer{"18446744073709551615"}}) {
+    Integer dividend = divisor * multiplier + (divisor - 1);
+    auto [quotient, remainder] = dividend.divmod(divisor);
+    EXPECT_EQ(quotient, multiplier);
+    EXPECT_EQ(remainder, divisor - 1);
+  }
+
+  Integer dividend{"340282366920938463463374607431768211455"}; // 2^128 - 1
+  Integer smallDivisor{"18446744073709551617"};                // 2^64 + 1
+  EXPECT_EQ(std::to_string(dividend / smallDivisor), "18446744073709551615");
+  EXPECT_EQ(std::to_string(dividend % smallDivisor), "0");
+}
+
 TEST(Integer, Modulo) {
   Integer negativeFifty{-50};
   Integer five{5};
@@ -283,6 +520,119 @@ TEST(Integer, Power) {
   EXPECT_EQ(std::to_string(std::pow(negativeFour, three)), "-64");
 }
 
+TEST(Integer, Power_Big) {
+  EXPECT_EQ(std::to_string(std::pow(Integer{2}, Integer{100})), "1267650600228229401496703205376");
+  EXPECT_EQ(std::to_string(std::pow(Integer{3}, Integer{200})),
+            "265613988875874769338781322035779626829233452653394495974574961739092490901302182994384699044001");
+  EXPECT_EQ(std::to_string(std::pow(Integer{-3}, Integer{101})), "-1546132562196033993109383389296863818106322566003");
+}
+
+TEST(Integer, PowMod) {
+  EXPECT_EQ(std::to_string(Integer{4}.powMod(Integer{13}, Integer{497})), "445");
+  EXPECT_EQ(std::to_string(Integer{2}.powMod(Integer{1000}, Integer{1000000007})), "688423210");
+  EXPECT_EQ(std::to_string(Integer{-7}.powMod(Integer{3}, Integer{10})), "7");
+  EXPECT_EQ(std::to_string(Integer{5}.powMod(Integer{0}, Integer{3})), "1");
+  EXPECT_EQ(std::to_string(Integer{5}.powMod(Integer{0}, Integer{1})), "0");
+  EXPECT_EQ(std::to_string(Integer{5}.powMod(Integer{3}, Integer{-7})), "6");
+
+  Integer base{"123456789123456789"};
+  Integer modulus{"1000000000000000000000000000057"};
+  EXPECT_EQ(std::to_string(base.powMod(Integer{12345}, modulus)), "713047808334959372798611385267");
+}
+
+TEST(Integer, Shifts) {
+  EXPECT_EQ(Integer{1} << 0, Integer{1});
+  EXPECT_EQ(Integer{1} << 100, Integer{2}.power(Integer{100}));
+  EXPECT_EQ(Integer{-3} << 64, Integer{-3} * Integer{2}.power(Integer{64}));
+  EXPECT_EQ(Integer{0} << 1000, Integer{0});
+  EXPECT_EQ(Integer{"4294967295"} << 1, Integer{"8589934590"});
+
+  auto big = Integer{"123456789012345678901234567890123456789"};
+  for (size_t bits : {0u, 1u, 31u, 32u, 33u, 64u, 100u, 127u, 130u}) {
+    EXPECT_EQ(big << bits >> bits, big);
+    EXPECT_EQ(big >> bits, big / Integer{2}.power(Integer{static_cast<intmax_t>(bits)}));
+    EXPECT_EQ(big * -1 >> bits, big * -1 / Integer{2}.power(Integer{static_cast<intmax_t>(bits)}));
+  }
+  EXPECT_EQ(Integer{-1} >> 1, Integer{0});
+  EXPECT_TRUE((Integer{-1} >> 1).positive());
+
+  Integer value{5};
+  value <<= 40;
+  EXPECT_EQ(value, Integer{5497558138880});
+  value >>= 39;
+  EXPECT_EQ(value, Integer{10});
+}
+
+TEST(Integer, Bitwise) {
+  // Machine words are two's complement too, so they should agree on every sign
+  std::vector<int64_t> values{0, 1, -1, 5, -5, 12345678901, -12345678901, INT32_MAX, INT32_MIN, INT64_MAX, INT64_MIN};
+  for (auto left : values) {
+    for (auto right : values) {
+      EXPECT_EQ(Integer{left} & Integer{right}, Integer{left & right});
+      EXPECT_EQ(Integer{left} | Integer{right}, Integer{left | right});
+      EXPECT_EQ(Integer{left} ^ Integer{right}, Integer{left ^ right});
+    }
+
+    for (size_t bit = 0; bit < 64; ++bit) {
+      EXPECT_EQ(Integer{left}.testBit(bit), ((static_cast<uint64_t>(left) >> bit) & 1) != 0);
+    }
+    EXPECT_EQ(Integer{left}.testBit(1000), left < 0);
+  }
+
+  auto big = Integer{2}.power(Integer{200}) - 1;
+  EXPECT_EQ(big & Integer{2}.power(Integer{100}) * -1, big - (Integer{2}.power(Integer{100}) - 1));
+  EXPECT_EQ(big ^ big, Integer{0});
+  EXPECT_EQ((big | Integer{-1}), Integer{-1});
+  EXPECT_TRUE(big.testBit(199));
+  EXPECT_FALSE(big.testBit(200));
+
+  Integer value{12};
+  value &= Integer{10};
+  EXPECT_EQ(value, Integer{8});
+  value |= Integer{3};
+  EXPECT_EQ(value, Integer{11});
+  value ^= Integer{1};
+  EXPECT_EQ(value, Integer{10});
+}
+
+TEST(Integer, CompoundAssignment) {
+  Integer value{"18446744073709551615"};
+  value += Integer{1};
+  EXPECT_EQ(std::to_string(value), "18446744073709551616");
+  value -= Integer{"18446744073709551617"};
+  EXPECT_EQ(std::to_string(value), "-1");
+  value += Integer{"-4294967296"};
+  EXPECT_EQ(std::to_string(value), "-4294967297");
+  value -= Integer{-4294967297};
+  EXPECT_EQ(std::to_string(value), "0");
+  value -= 5;
+  EXPECT_EQ(std::to_string(value), "-5");
+  value += 8;
+  EXPECT_EQ(std::to_string(value), "3");
+  value *= -4294967296;
+  EXPECT_EQ(std::to_string(value), "-12884901888");
+  value *= 3;
+  EXPECT_EQ(std::to_string(value), "-38654705664");
+  value *= 0;
+  EXPECT_EQ(value, 0);
+
+  Integer itself{"123456789012345678901234567890"};
+  itself += itself;
+  EXPECT_EQ(std::to_string(itself), "246913578024691357802469135780");
+  itself -= itself;
+  EXPECT_EQ(itself, 0);
+}
+
+TEST(Integer, Arithmetic_Temporaries) {
+  Integer big{"123456789012345678901234567890"};
+
+  EXPECT_EQ(std::to_string(Integer{big} + big), "246913578024691357802469135780");
+  EXPECT_EQ(std::to_string(Integer{big} - Integer{"123456789012345678901234567891"}), "-1");
+  EXPECT_EQ(std::to_string(Integer{big} + 10), "123456789012345678901234567900");
+  EXPECT_EQ(std::to_string(Integer{big} - 90), "123456789012345678901234567800");
+  EXPECT_EQ(std::to_string(Integer{big} * -2), "-246913578024691357802469135780");
+}
+
 TEST(Integer, Comparison_EqualTo) {
   EXPECT_TRUE(Integer{-1} == Integer{-1});
   EXPECT_TRUE(Integer{0} == Integer{0});
@@ -24,6 +24,9 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
+#include <vector>
+
 using namespace pzl;
 
 TEST(Integers, GreatestCommonDivisor) {
@@ -31,6 +34,31 @@ TEST(Integers, GreatestCommonDivisor) {
   EXPECT_EQ(greatestCommonDivisor(Integer{17}, Integer{19}), Integer{1});
   EXPECT_EQ(greatestCommonDivisor(Integer{10}, Integer{25}), Integer{5});
   EXPECT_EQ(greatestCommonDivisor(Integer{3154}, Integer{4522}), Integer{38});
+
+  EXPECT_EQ(greatestCommonDivisor(Integer{0}, Integer{-5}), Integer{5});
+  EXPECT_EQ(greatestCommonDivisor(Integer{-12}, Integer{0}), Integer{12});
+  EXPECT_EQ(greatestCommonDivisor(Integer{-12}, Integer{-18}), Integer{6});
+}
+
+TEST(Integers, GreatestCommonDivisor_Big) {
+  // Consecutive Fibonacci numbers are Euclid's worst case, and gcd(F(m), F(n)) = F(gcd(m, n))
+  std::vector<Integer> fibonacci{Integer{0}, Integer{1}};
+  while (fibonacci.size() <= 1000) {
+    fibonacci.push_back(fibonacci[fibonacci.size() - 1] + fibonacci[fibonacci.size() - 2]);
+  }
+
+  EXPECT_EQ(greatestCommonDivisor(fibonacci[1000], fibonacci[999]), Integer{1});
+  EXPECT_EQ(greatestCommonDivisor(fibonacci[1000], fibonacci[750]), fibonacci[250]);
+  EXPECT_EQ(greatestCommonDivisor(fibonacci[960], fibonacci[1000]), fibonacci[40]);
+  EXPECT_EQ(greatestCommonDivisor(fibonacci[999], fibonacci[666]), fibonacci[333]);
+
+  Integer common{"340282366920938463463374607431768211507"};
+  Integer left = common * Integer{"18446744073709551557"} * Integer{"1000000007"};
+  Integer right = common * Integer{"18446744073709551533"} * -1;
+  EXPECT_EQ(greatestCommonDivisor(left, right), common);
+  EXPECT_EQ(greatestCommonDivisor(right, left), common);
+  EXPECT_EQ(greatestCommonDivisor(left, left * 3), left);
+  EXPECT_EQ(greatestCommonDivisor(left, Integer{1000000007}), Integer{1000000007});
 }
 
 TEST(Integers, LowestCommonMultiple) {
@@ -48,3 +76,95 @@ TEST(Integers, GreatestPowerOfTwo) {
   EXPECT_EQ(greatestPowerOfTwo(Integer{9}), Integer{8});
   EXPECT_EQ(greatestPowerOfTwo(Integer{127}), Integer{64});
 }
+
+TEST(Integers, FixedIntegers) {
+  using Fixed = FixedInteger<128>;
+
+  EXPECT_EQ(greatestCommonDivisor(Fixed{3154}, Fixed{4522}), Fixed{38});
+  EXPECT_EQ(greatestCommonDivisor(Fixed{0}, Fixed{-5}), Fixed{5});
+  EXPECT_EQ(greatestCommonDivisor(Fixed{-12}, Fixed{-18}), Fixed{6});
+  EXPECT_EQ(greatestCommonDivisor(Fixed{"18446744073709551616"} * 3, Fixed{"36893488147419103232"} * 5),
+            Fixed{"18446744073709551616"});
+
+  EXPECT_EQ(lowestCommonMultiple(Fixed{10}, Fixed{25}), Fixed{50});
+
+  EXPECT_EQ(greatestPowerOfTwo(Fixed{1}), Fixed{1});
+  EXPECT_EQ(greatestPowerOfTwo(Fixed{127}), Fixed{64});
+  EXPECT_EQ(greatestPowerOfTwo(Fixed{"18446744073709551617"}), Fixed{"18446744073709551616"});
+}
+
+TEST(Integers, Roots) {
+  for (intmax_t value = 0; value < 5000; ++value) {
+    for (size_t k : {1u, 2u, 3u, 5u}) {
+      auto root = iroot(Integer{value}, k);
+      auto integerK = Integer{static_cast<intmax_t>(k)};
+      EXPECT_LE(root.power(integerK), Integer{value});
+      EXPECT_GT((root + 1).power(integerK), Integer{value});
+    }
+
+    auto root = isqrt(Integer{value});
+    EXPECT_EQ(isPerfectSquare(Integer{value}), root * root == Integer{value});
+  }
+
+  EXPECT_EQ(isqrt(Integer{"18446744073709551615"}), Integer{"4294967295"});
+  EXPECT_EQ(isqrt(Integer{"18446744073709551616"}), Integer{"4294967296"});
+  EXPECT_EQ(iroot(Integer{"18446744073709551615"}, 3), Integer{2642245});
+  EXPECT_EQ(iroot(Integer{"18446744073709551615"}, 64), Integer{1});
+  EXPECT_FALSE(isPerfectSquare(Integer{-4}));
+}
+
+TEST(Integers, Roots_Big) {
+  std::string digits;
+  for (auto i = 0; i < 2000; ++i) {
+    digits += std::to_string((i * 7919) % 1000000007);
+  }
+  Integer root{digits};
+
+  for (size_t k : {2u, 3u, 7u}) {
+    auto power = root.power(Integer{static_cast<intmax_t>(k)});
+    EXPECT_EQ(iroot(power, k), root);
+    EXPECT_EQ(iroot(power - 1, k), root - 1);
+    EXPECT_EQ(iroot(power + 1, k), root);
+  }
+
+  // Wider than a word, but with roots only a bit or two long
+  auto twoToThe100 = Integer{1} << 100;
+  EXPECT_EQ(iroot(twoToThe100, 50), Integer{4});
+  EXPECT_EQ(iroot(twoToThe100, 61), Integer{3});
+  EXPECT_EQ(iroot(twoToThe100, 100), Integer{2});
+  EXPECT_EQ(iroot(twoToThe100 - 1, 100), Integer{1});
+  EXPECT_EQ(iroot(twoToThe100, 101), Integer{1});
+  EXPECT_EQ(iroot(twoToThe100, 1000), Integer{1});
+
+  auto square = root * root;
+  EXPECT_TRUE(isPerfectSquare(square));
+  EXPECT_FALSE(isPerfectSquare(square + 1));
+  EXPECT_FALSE(isPerfectSquare(square - 1));
+  EXPECT_FALSE(isPerfectSquare(square + root * 2)); // Right before (root + 1)^2
+}
+
+TEST(Integers, IsProbablePrime) {
+  for (auto i = -5; i < 200; ++i) {
+    auto expected = i > 1;
+    for (auto j = 2; j * j <= i; ++j) {
+      if (i % j == 0) expected = false;
+    }
+    EXPECT_EQ(isProbablePrime(Integer{i}), expected) << i;
+  }
+
+  // Mersenne primes
+  EXPECT_TRUE(isProbablePrime(Integer{"2305843009213693951"}));
+  EXPECT_TRUE(isProbablePrime(Integer{"618970019642690137449562111"}));
+  EXPECT_TRUE(isProbablePrime(Integer{"170141183460469231731687303715884105727"}));
+
+  EXPECT_TRUE(isProbablePrime(Integer{"18446744073709551629"}));
+  EXPECT_TRUE(isProbablePrime(Integer{"1000000000000000000000000000057"}));
+
+  EXPECT_FALSE(isProbablePrime(Integer{"1427247692705959880439315947500961989719490561"}));
+  EXPECT_FALSE(isProbablePrime(Integer{"1000000000000000000000000000001"}));
+  EXPECT_FALSE(isProbablePrime(Integer{"3825123056546413051"}));
+  // Every prime up to 37 fails to prove this one composite, so it takes 41
+  EXPECT_FALSE(isProbablePrime(Integer{"318665857834031151167461"}, 0));
+  // And every prime up to 41 fails for this one, so it takes one of the random bases
+  EXPECT_FALSE(isProbablePrime(Integer{"3317044064679887385961981"}));
+}
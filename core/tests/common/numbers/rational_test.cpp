@@ -24,6 +24,10 @@
 
 #include <gtest/gtest.h>
 
+#include <limits>
+#include <string>
+#include <utility>
+
 using pzl::Rational;
 
 TEST(Numbers_Rational, CreateFromString) {
@@ -205,6 +209,22 @@ TEST(Numbers_Rational, Division) {
   EXPECT_EQ(std::to_string(minusThreeTwentyFive / two), "-325/2");
 }
 
+TEST(Numbers_Rational, Division_Fractions) {
+  EXPECT_EQ(std::to_string(Rational(1, 3) / Rational(2, 7)), "7/6");
+  EXPECT_EQ(std::to_string(Rational(2, 7) / Rational(1, 3)), "6/7");
+  EXPECT_EQ(std::to_string(Rational(4, 9) / Rational(2, 3)), "2/3");
+  EXPECT_EQ(std::to_string(Rational(-4, 9) / Rational(2, 3)), "-2/3");
+  EXPECT_EQ(std::to_string(Rational(4, 9) / Rational(-2, 3)), "-2/3");
+  EXPECT_EQ(std::to_string(Rational(-4, 9) / Rational(-2, 3)), "2/3");
+  EXPECT_EQ(std::to_string(Rational(3, 4) / Rational(3, 4)), "1");
+  EXPECT_EQ(std::to_string(Rational(0) / Rational(3, 4)), "0");
+  EXPECT_EQ(std::to_string(Rational(5) / Rational(1, 5)), "25");
+  EXPECT_EQ(std::to_string(Rational(1, 5) / Rational(5)), "1/25");
+
+  EXPECT_EQ(std::to_string(Rational(1, 3).lazy() / Rational(2, 7)), "7/6");
+  EXPECT_EQ(std::to_string(Rational(-4, 9) / Rational(-2, 3).lazy()), "2/3");
+}
+
 TEST(Numbers_Rational, Power) {
   Rational negativeFour(-4);
   Rational negativeOne(-1);
@@ -230,6 +250,15 @@ TEST(Numbers_Rational, Power) {
   EXPECT_EQ(std::to_string(std::pow(negativeFour, three)), "-64");
 }
 
+TEST(Numbers_Rational, Power_Fractions) {
+  EXPECT_EQ(std::to_string(std::pow(Rational(2, 3), Rational(5))), "32/243");
+  EXPECT_EQ(std::to_string(std::pow(Rational(-1, 2), Rational(3))), "-1/8");
+  EXPECT_EQ(std::to_string(std::pow(Rational(-1, 2), Rational(0))), "1");
+  EXPECT_EQ(std::to_string(std::pow(Rational(5, 7), Rational(1))), "5/7");
+  EXPECT_EQ(std::to_string(std::pow(Rational(3, 2), Rational(64))),
+            "3433683820292512484657849089281/18446744073709551616");
+}
+
 TEST(Numbers_Rational, Comparison_LessThan) {
   EXPECT_TRUE(Rational(0) < Rational(1));
   EXPECT_TRUE(Rational(9) < Rational(10));
@@ -248,6 +277,34 @@ TEST(Numbers_Rational, Comparison_LessThan) {
   EXPECT_FALSE(Rational(-500) < Rational(-500));
 }
 
+TEST(Numbers_Rational, Comparison_LessThan_Fractions) {
+  EXPECT_TRUE(Rational(1, 3) < Rational(1, 2));
+  EXPECT_TRUE(Rational(-1, 2) < Rational(-1, 3));
+  EXPECT_TRUE(Rational(-1, 2) < Rational(0));
+  EXPECT_TRUE(Rational(1, 1000) < Rational(999, 1));
+  EXPECT_TRUE(Rational(-999, 1) < Rational(-1, 1000));
+  EXPECT_TRUE(Rational(1000000, 1000001) < Rational(1000001, 1000002));
+
+  Rational almostOne{pzl::Integer{"340282366920938463463374607431768211455"},
+                     pzl::Integer{"340282366920938463463374607431768211456"}};
+  EXPECT_TRUE(almostOne < Rational(1));
+  EXPECT_FALSE(Rational(1) < almostOne);
+
+  EXPECT_FALSE(Rational(1, 2) < Rational(1, 3));
+  EXPECT_FALSE(Rational(-1, 3) < Rational(-1, 2));
+  EXPECT_FALSE(Rational(0) < Rational(-1, 2));
+  EXPECT_FALSE(Rational(999, 1) < Rational(1, 1000));
+  EXPECT_FALSE(Rational(1000001, 1000002) < Rational(1000000, 1000001));
+  EXPECT_FALSE(Rational(2, 4) < Rational(1, 2));
+
+  EXPECT_TRUE(Rational(1, 2) <= Rational(1, 2));
+  EXPECT_TRUE(Rational(1, 3) <= Rational(1, 2));
+  EXPECT_FALSE(Rational(1, 2) <= Rational(1, 3));
+  EXPECT_TRUE(Rational(1, 2) >= Rational(1, 2));
+  EXPECT_TRUE(Rational(1, 2) >= Rational(1, 3));
+  EXPECT_FALSE(Rational(1, 3) >= Rational(1, 2));
+}
+
 TEST(Numbers_Rational, Comparison_EqualToRational) {
   EXPECT_TRUE(Rational(-1) == Rational(-1));
   EXPECT_TRUE(Rational(0) == Rational(0));
@@ -317,3 +374,127 @@ TEST(Numbers_Rational, ToString_Expansion_NonTerminating) {
 
   EXPECT_EQ(Rational(232, 70).toStringWithDecimalExpansion(), "3.3(142857)");
 }
+
+TEST(Numbers_Rational, ToString_Expansion_Negative) {
+  EXPECT_EQ(Rational(-1, 2).toStringWithDecimalExpansion(), "-0.5");
+  EXPECT_EQ(Rational(-4, 3).toStringWithDecimalExpansion(), "-1.(3)");
+  EXPECT_EQ(Rational(-73, 12).toStringWithDecimalExpansion(), "-6.08(3)");
+}
+
+TEST(Numbers_Rational, ToString_Expansion_Big) {
+  auto big = pzl::Integer{"100000000000000000000"};
+  EXPECT_EQ(Rational(big + pzl::Integer{1}, big).toStringWithDecimalExpansion(), "1.00000000000000000001");
+  EXPECT_EQ(Rational(pzl::Integer{1}, big * 3).toStringWithDecimalExpansion(), "0.00000000000000000000(3)");
+}
+
+#if defined(__cpp_impl_coroutine)
+
+TEST(Numbers_Rational, DecimalDigits) {
+  auto firstDigits = [](const Rational &value, size_t count) {
+    auto digits = value.decimalDigits();
+    auto it = digits.begin();
+
+    std::string result;
+    for (size_t i = 0; i < count; ++i, ++it) {
+      result += static_cast<char>('0' + *it);
+    }
+    return result;
+  };
+
+  EXPECT_EQ(firstDigits(Rational(22, 7), 14), "14285714285714");
+  EXPECT_EQ(firstDigits(Rational(73, 12), 6), "083333");
+  // Terminating expansions carry on with zeroes
+  EXPECT_EQ(firstDigits(Rational(-5, 8), 6), "625000");
+  auto big = Rational(pzl::Integer{1}, pzl::Integer{"300000000000000000000"});
+  EXPECT_EQ(firstDigits(big, 24), "000000000000000000003333");
+}
+
+#endif // defined(__cpp_impl_coroutine)
+
+TEST(Numbers_Rational, DecimalPeriod) {
+  using Period = std::pair<size_t, size_t>;
+  EXPECT_EQ(Rational(3).decimalPeriod(), Period(0, 0));
+  EXPECT_EQ(Rational(1, 8).decimalPeriod(), Period(3, 0));
+  EXPECT_EQ(Rational(1, 3).decimalPeriod(), Period(0, 1));
+  EXPECT_EQ(Rational(22, 7).decimalPeriod(), Period(0, 6));
+  EXPECT_EQ(Rational(73, 12).decimalPeriod(), Period(2, 1));
+  EXPECT_EQ(Rational(232, 70).decimalPeriod(), Period(1, 6));
+  EXPECT_EQ(Rational(-1, 97).decimalPeriod(), Period(0, 96));
+
+  EXPECT_EQ(Rational(1, 1000003).decimalPeriod(), Period(0, 166667));
+  EXPECT_EQ(Rational(1, 1000171).decimalPeriod(), Period(0, 1000170)); // 10 is a primitive root of 1000171
+  EXPECT_EQ(Rational(pzl::Integer{1}, pzl::Integer{"1000000000000000000000"} * 3).decimalPeriod(), Period(21, 1));
+}
+
+TEST(Numbers_Rational, Lazy) {
+  auto lazySum = Rational{0}.lazy();
+  auto eagerSum = Rational{0};
+  for (auto i = 1; i <= 30; ++i) {
+    lazySum += Rational{1, i};
+    eagerSum += Rational{1, i};
+  }
+
+  EXPECT_TRUE(lazySum.isLazy());
+  EXPECT_FALSE(eagerSum.isLazy());
+  EXPECT_EQ(lazySum, eagerSum);
+  EXPECT_EQ(eagerSum, lazySum);
+  EXPECT_EQ(std::to_string(lazySum), std::to_string(eagerSum));
+  EXPECT_EQ(std::to_string(lazySum.eager()), "9304682830147/2329089562800");
+  EXPECT_FALSE(lazySum.eager().isLazy());
+
+  auto half = Rational{1, 2}.lazy();
+  auto twoQuarters = half * Rational{2} * Rational{1, 2};
+  EXPECT_TRUE(twoQuarters.isLazy());
+  EXPECT_EQ(twoQuarters, Rational(1, 2));
+  EXPECT_TRUE(twoQuarters < Rational(2, 3));
+  EXPECT_TRUE(Rational(1, 3) < twoQuarters);
+  EXPECT_TRUE(twoQuarters - half == 0);
+  EXPECT_TRUE((twoQuarters * Rational{4}).eager() == 2);
+  EXPECT_EQ(std::to_string(std::pow(twoQuarters, Rational{3})), "1/8");
+  EXPECT_EQ(std::to_string(Rational{6}.lazy() / Rational{4}.lazy()), "3/2");
+  EXPECT_EQ(twoQuarters.toStringWithDecimalExpansion(), "0.5");
+}
+
+TEST(Numbers_Rational, Lazy_SimplifiesPastThreshold) {
+  const auto defaultThreshold = Rational::lazyThreshold;
+  Rational::lazyThreshold = 64;
+
+  auto value = Rational{1}.lazy();
+  for (auto i = 0; i < 100; ++i) {
+    // Without simplifying, this would grow to (2^100)/(2^100)
+    value *= Rational{2};
+    value *= Rational{1, 2};
+  }
+  EXPECT_EQ(value, 1);
+  EXPECT_EQ(std::to_string(value), "1");
+  EXPECT_TRUE(value.isLazy());
+
+  Rational::lazyThreshold = defaultThreshold;
+}
+
+TEST(Numbers_Rational, MachineWordOverflow) {
+  const auto max = std::numeric_limits<intmax_t>::max();
+  const auto min = std::numeric_limits<intmax_t>::min();
+
+  EXPECT_EQ(std::to_string(Rational{max} + Rational{1}), "9223372036854775808");
+  EXPECT_EQ(std::to_string(Rational{min}), "-9223372036854775808");
+  EXPECT_EQ(std::to_string(Rational{min} - Rational{1}), "-9223372036854775809");
+  EXPECT_EQ(std::to_string(Rational{-max} - Rational{1}), "-9223372036854775808");
+  EXPECT_EQ(std::to_string(Rational{1, min}), "-1/9223372036854775808");
+  EXPECT_EQ(std::to_string(Rational{min, min}), "1");
+  EXPECT_EQ(std::to_string(Rational{max} * Rational{max}), "85070591730234615847396907784232501249");
+  EXPECT_EQ(std::to_string(Rational{1, max} * Rational{1, max - 1}), "1/85070591730234615838173535747377725442");
+  EXPECT_EQ(std::to_string(Rational{1, max} - Rational{1, max - 1}), "-1/85070591730234615838173535747377725442");
+  EXPECT_EQ(std::to_string(Rational{max} / Rational{1, 2}), "18446744073709551614");
+  EXPECT_EQ(std::to_string(std::pow(Rational{3, 2}, Rational{41})), "36472996377170786403/2199023255552");
+
+  // Going back down into machine words once the value fits again
+  auto big = Rational{max} * Rational{4};
+  EXPECT_EQ(big / Rational{4}, Rational{max});
+  EXPECT_EQ(big - big, 0);
+  EXPECT_EQ(big * Rational(1, 2) - Rational{max}, Rational{max});
+  EXPECT_TRUE(Rational{max} < big);
+  EXPECT_TRUE(Rational{min} < Rational{-max});
+  EXPECT_TRUE(Rational(max - 2, max - 1) < Rational(max - 1, max));
+  EXPECT_EQ(big.lazy() / Rational{4}.lazy(), Rational{max});
+}
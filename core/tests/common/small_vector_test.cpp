@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "common/small_vector.h"
+
+#include <gtest/gtest.h>
+
+using pzl::SmallVector;
+
+TEST(SmallVector, ShouldStartEmptyAndInline) {
+  SmallVector<int, 4> vector;
+
+  EXPECT_TRUE(vector.empty());
+  EXPECT_EQ(vector.size(), 0);
+  EXPECT_TRUE(vector.isInline());
+}
+
+TEST(SmallVector, ConstructingWithCount) {
+  SmallVector<int, 4> small(3, 7);
+  SmallVector<int, 4> big(5, 9);
+
+  EXPECT_EQ(small.size(), 3);
+  EXPECT_TRUE(small.isInline());
+  EXPECT_EQ(small[0], 7);
+  EXPECT_EQ(small[2], 7);
+
+  EXPECT_EQ(big.size(), 5);
+  EXPECT_FALSE(big.isInline());
+  EXPECT_EQ(big[0], 9);
+  EXPECT_EQ(big[4], 9);
+}
+
+TEST(SmallVector, PushShouldSpillToTheHeap) {
+  SmallVector<int, 2> vector;
+
+  vector.push_back(1);
+  vector.push_back(2);
+  EXPECT_TRUE(vector.isInline());
+
+  vector.push_back(3);
+  EXPECT_FALSE(vector.isInline());
+  EXPECT_EQ(vector.size(), 3);
+  EXPECT_EQ(vector.front(), 1);
+  EXPECT_EQ(vector[1], 2);
+  EXPECT_EQ(vector.back(), 3);
+}
+
+TEST(SmallVector, ShrinkToFitShouldGoBackInline) {
+  SmallVector<int, 2> vector(5, 1);
+  EXPECT_FALSE(vector.isInline());
+
+  vector.shrink_to_fit();
+  EXPECT_FALSE(vector.isInline());
+
+  vector.pop_back();
+  vector.pop_back();
+  vector.pop_back();
+  vector.shrink_to_fit();
+  EXPECT_TRUE(vector.isInline());
+  EXPECT_EQ(vector.size(), 2);
+  EXPECT_EQ(vector[0], 1);
+  EXPECT_EQ(vector[1], 1);
+}
+
+TEST(SmallVector, CopyAndMove) {
+  SmallVector<int, 2> small(2, 3);
+  SmallVector<int, 2> big(4, 5);
+
+  auto smallCopy = small;
+  auto bigCopy = big;
+  EXPECT_EQ(smallCopy, small);
+  EXPECT_EQ(bigCopy, big);
+  EXPECT_NE(smallCopy, bigCopy);
+
+  auto movedSmall = std::move(smallCopy);
+  auto movedBig = std::move(bigCopy);
+  EXPECT_EQ(movedSmall, small);
+  EXPECT_EQ(movedBig, big);
+  EXPECT_TRUE(smallCopy.empty()); // NOLINT(bugprone-use-after-move)
+  EXPECT_TRUE(bigCopy.empty());   // NOLINT(bugprone-use-after-move)
+
+  movedSmall = movedBig;
+  EXPECT_EQ(movedSmall, big);
+  movedBig = small;
+  EXPECT_EQ(movedBig, small);
+}
+
+TEST(SmallVector, ResizeAndIterate) {
+  SmallVector<int, 2> vector;
+  vector.resize(3, 4);
+  vector[1] = 5;
+
+  std::vector<int> forward(vector.begin(), vector.end());
+  std::vector<int> backward(vector.crbegin(), vector.crend());
+  EXPECT_EQ(forward, (std::vector<int>{4, 5, 4}));
+  EXPECT_EQ(backward, (std::vector<int>{4, 5, 4}));
+
+  vector.resize(1);
+  EXPECT_EQ(vector.size(), 1);
+  EXPECT_EQ(vector.back(), 4);
+
+  vector.clear();
+  EXPECT_TRUE(vector.empty());
+}
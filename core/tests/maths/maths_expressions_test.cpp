@@ -72,6 +72,19 @@ TEST(Expressions, Evaluator_ComplexExpressionTwo) {
             "-508/3");
 }
 
+TEST(Expressions, Evaluator_DividingFractions) {
+  EXPECT_EQ(std::to_string(evaluateExpression("1/3 / (2/7)")), "7/6");
+  EXPECT_EQ(std::to_string(evaluateExpression("(1/3) / (2/7) / (-5/4)")), "-14/15");
+
+  // Every pair of divisions multiplies the result by 49/4
+  std::string expression = "1/3";
+  for (auto i = 0; i < 2000; ++i) {
+    expression += " / (2/7)";
+  }
+  auto expected = std::pow(Rational(49, 4), Rational(1000)) / Rational(3);
+  EXPECT_EQ(evaluateExpression(expression), expected);
+}
+
 TEST(Expressions, Tokenizer) {
   Token plus('+');
   Token minus('-');
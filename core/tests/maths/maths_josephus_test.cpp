@@ -39,6 +39,11 @@ TEST(Maths, ArithmeticSolver) {
   EXPECT_EQ(solve(Integer{8}), 1);
   EXPECT_EQ(solve(Integer{9}), 3);
   EXPECT_EQ(solve(Integer{10}), 5);
+
+  auto big = Integer{2}.power(Integer{1000});
+  EXPECT_EQ(solve(big), 1);
+  EXPECT_EQ(solve(big + 5), 11);
+  EXPECT_EQ(solve(big * 2 - 1), big * 2 - 1);
 }
 
 TEST(Maths, SimulationSolver) {
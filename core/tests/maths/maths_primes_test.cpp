@@ -26,6 +26,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 using namespace Maths;
 
 TEST(Maths, IsPrime) {
@@ -48,3 +50,88 @@ TEST(Maths, LargestPrimeFactor) {
   EXPECT_EQ(largestPrimeFactor(6), 3);
   EXPECT_EQ(largestPrimeFactor(13195), 29);
 }
+
+TEST(Maths, EulerTotient) {
+  EXPECT_EQ(eulerTotient(1), 1);
+  EXPECT_EQ(eulerTotient(2), 1);
+  EXPECT_EQ(eulerTotient(9), 6);
+  EXPECT_EQ(eulerTotient(36), 12);
+  EXPECT_EQ(eulerTotient(97), 96);
+  EXPECT_EQ(eulerTotient(1000000), 400000);
+}
+
+TEST(Maths, PowMod) {
+  EXPECT_EQ(powMod(2, 10, 1000), 24);
+  EXPECT_EQ(powMod(3, 0, 7), 1);
+  EXPECT_EQ(powMod(3, 0, 1), 0);
+  // Fermat's little theorem, with a modulus big enough that the products need 128 bits
+  EXPECT_EQ(powMod(3, 18446744073709551556u, 18446744073709551557u), 1);
+}
+
+TEST(Maths, MultiplicativeOrder) {
+  EXPECT_EQ(multiplicativeOrder(10, 3), 1);
+  EXPECT_EQ(multiplicativeOrder(10, 7), 6);
+  EXPECT_EQ(multiplicativeOrder(10, 37), 3);
+  EXPECT_EQ(multiplicativeOrder(10, 1000003), 166667);
+  EXPECT_EQ(multiplicativeOrder(10, 1000171), 1000170);
+  EXPECT_EQ(multiplicativeOrder(2, 9), 6);
+  EXPECT_EQ(multiplicativeOrder(7, 1), 1);
+
+  // There's no order when they share a factor
+  EXPECT_EQ(multiplicativeOrder(10, 2), 0);
+  EXPECT_EQ(multiplicativeOrder(10, 15), 0);
+
+  static_assert(multiplicativeOrder(10, 17) == 16);
+}
+
+TEST(Maths, IsPrime_Big) {
+  EXPECT_TRUE(isPrime(2305843009213693951u));  // 2^61 - 1
+  EXPECT_TRUE(isPrime(18446744073709551557u)); // The biggest 64-bit prime
+  EXPECT_TRUE(isPrime(1000000007u));
+
+  // Strong pseudoprimes to several of the smaller bases
+  EXPECT_FALSE(isPrime(3215031751u));
+  EXPECT_FALSE(isPrime(4759123141u));
+  EXPECT_FALSE(isPrime(3825123056546413051u));
+  EXPECT_FALSE(isPrime(18446744073709551559u));
+  EXPECT_FALSE(isPrime(998244359987710471u)); // 1000000007 * 998244353
+  EXPECT_FALSE(isPrime(uintmax_t{4294967291u} * 4294967291u));
+
+  static_assert(isPrime(1000000007u));
+  static_assert(!isPrime(3215031751u));
+}
+
+TEST(Maths, Factorize) {
+  using Factors = std::vector<PrimeFactor>;
+  EXPECT_EQ(factorize(1), Factors{});
+  EXPECT_EQ(factorize(2), (Factors{{2, 1}}));
+  EXPECT_EQ(factorize(720720), (Factors{{2, 4}, {3, 2}, {5, 1}, {7, 1}, {11, 1}, {13, 1}}));
+  EXPECT_EQ(factorize(600851475143), (Factors{{71, 1}, {839, 1}, {1471, 1}, {6857, 1}}));
+  EXPECT_EQ(factorize(uintmax_t{1} << 63), (Factors{{2, 63}}));
+  EXPECT_EQ(factorize(18446744073709551557u), (Factors{{18446744073709551557u, 1}}));
+  EXPECT_EQ(factorize(18446744073709551615u),
+            (Factors{{3, 1}, {5, 1}, {17, 1}, {257, 1}, {641, 1}, {65537, 1}, {6700417, 1}}));
+
+  // These need Pollard's rho, since none of their factors are small
+  EXPECT_EQ(factorize(uintmax_t{4294967291u} * 4294967279u), (Factors{{4294967279u, 1}, {4294967291u, 1}}));
+  EXPECT_EQ(factorize(uintmax_t{4294967291u} * 4294967291u), (Factors{{4294967291u, 2}}));
+  EXPECT_EQ(factorize(uintmax_t{1000003} * 1000033 * 1000037), (Factors{{1000003, 1}, {1000033, 1}, {1000037, 1}}));
+  EXPECT_EQ(factorize(3825123056546413051u), (Factors{{149491, 1}, {747451, 1}, {34233211, 1}}));
+
+  static_assert(factorize(1234567890).size() == 5);
+}
+
+TEST(Maths, DivisorCount) {
+  EXPECT_EQ(divisorCount(1), 1);
+  EXPECT_EQ(divisorCount(2), 2);
+  EXPECT_EQ(divisorCount(12), 6);
+  EXPECT_EQ(divisorCount(720720), 240);
+  EXPECT_EQ(divisorCount(897612484786617600u), 103680);
+}
+
+TEST(Maths, LargestPrimeFactor_Big) {
+  EXPECT_EQ(largestPrimeFactor(1), 1);
+  EXPECT_EQ(largestPrimeFactor(600851475143), 6857);
+  EXPECT_EQ(largestPrimeFactor(18446744073709551615u), 6700417);
+  EXPECT_EQ(largestPrimeFactor(uintmax_t{4294967291u} * 4294967279u), 4294967291u);
+}
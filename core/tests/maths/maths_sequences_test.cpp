@@ -62,6 +62,32 @@ TEST(Maths, Sequences_HighlyCompositeNumbers) {
   EXPECT_EQ(next(it), 7560);
 }
 
+TEST(Maths, Sequences_HighlyCompositeNumbers_Big) {
+  auto sequence = Sequences::highlyCompositeNumbers();
+  auto it = sequence.begin();
+
+  for (auto i = 1; i < 100; ++i) {
+    ++it;
+  }
+  EXPECT_EQ(*it, 2248776129600u);
+
+  for (auto i = 100; i < 156; ++i) {
+    ++it;
+  }
+  // The biggest one below 10^18
+  EXPECT_EQ(*it, 897612484786617600u);
+
+  for (auto i = 156; i < 170; ++i) {
+    ++it;
+  }
+  // The biggest one that fits in 64 bits
+  EXPECT_EQ(*it, 18401055938125660800u);
+
+  // And that's where the sequence ends
+  ++it;
+  EXPECT_FALSE(it != sequence.end());
+}
+
 TEST(Maths, Sequences_Emirps) {
   auto sequence = Sequences::emirps();
   auto it = sequence.begin();
@@ -118,6 +144,21 @@ TEST(Maths, Sequences_Emirps) {
   EXPECT_EQ(next(it), 1193);
 }
 
+TEST(Maths, Sequences_Emirps_Big) {
+  auto sequence = Sequences::emirps();
+  auto it = sequence.begin();
+
+  for (auto i = 1; i < 1000; ++i) {
+    ++it;
+  }
+  EXPECT_EQ(*it, 70529);
+
+  for (auto i = 1000; i < 100000; ++i) {
+    ++it;
+  }
+  EXPECT_EQ(*it, 11293973);
+}
+
 TEST(Maths, Sequences_Primes) {
   auto sequence = Sequences::primes();
   auto it = sequence.begin();
@@ -155,3 +196,21 @@ TEST(Maths, Sequences_PeriodOfDecimalExpansionOfReciprocalOfPrimes) {
 }
 
 #endif // defined(__cpp_impl_coroutine)
+
+TEST(Maths, Sequences_HighlyCompositeNumbersUpTo) {
+  EXPECT_TRUE(Sequences::highlyCompositeNumbersUpTo(pzl::Integer{0}).empty());
+
+  auto small = Sequences::highlyCompositeNumbersUpTo(pzl::Integer{60});
+  std::vector<pzl::Integer> expected;
+  for (auto value : {1, 2, 4, 6, 12, 24, 36, 48, 60}) {
+    expected.emplace_back(value);
+  }
+  EXPECT_EQ(small, expected);
+
+  auto big = Sequences::highlyCompositeNumbersUpTo(pzl::Integer{"1000000000000000000000000"});
+  ASSERT_EQ(big.size(), 219);
+  EXPECT_EQ(big[155], pzl::Integer{"897612484786617600"});
+  EXPECT_EQ(big[169], pzl::Integer{"18401055938125660800"});
+  EXPECT_EQ(big[217], pzl::Integer{"818147749120943130489600"});
+  EXPECT_EQ(big[218], pzl::Integer{"985496152350226952635200"});
+}
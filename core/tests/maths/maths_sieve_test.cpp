@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Emanuel Machado da Silva
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "maths/sieve.h"
+
+#include "maths/primes.h"
+#include "maths/sequences.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace Maths;
+
+TEST(Maths, SegmentedSieve_StartingLater) {
+  // The first one has wheel primes in it, which the pattern has crossed out, and the other starts at an odd number
+  for (uintmax_t from : {10u, 1000001u}) {
+    std::vector<uintmax_t> expected, actual;
+    for (auto i = from; i < from + 1000000; ++i) {
+      if (isPrime(i)) expected.push_back(i);
+    }
+
+    SegmentedSieve sieve{from};
+    std::vector<uint64_t> segment;
+    for (uintmax_t end = from / 2; 2 * end < from + 1000000;) {
+      auto begin = sieve.next(&segment);
+      end = begin + segment.size() * 64;
+      for (size_t bit = 0; bit < segment.size() * 64; ++bit) {
+        auto value = 2 * (begin + bit) + 1;
+        if ((segment[bit / 64] >> (bit % 64) & 1) != 0 && value < from + 1000000) actual.push_back(value);
+      }
+    }
+    EXPECT_EQ(actual, expected) << from;
+  }
+}
+
+#if defined(__cpp_impl_coroutine)
+
+TEST(Maths, SegmentedSieve_MatchesIsPrime) {
+  // Enough primes to cross a few segment boundaries
+  auto sequence = Sequences::primes();
+  auto it = sequence.begin();
+  size_t count = 0;
+  for (uintmax_t i = 0; i < 3000000; ++i) {
+    if (!isPrime(i)) continue;
+
+    ASSERT_EQ(*it, i);
+    ++it;
+    ++count;
+  }
+  EXPECT_EQ(count, 216816);
+  EXPECT_EQ(*it, 3000017);
+}
+
+#endif // defined(__cpp_impl_coroutine)
@@ -33,7 +33,7 @@ TEST(Shuriken, SwapTop) {
   auto swapped = shuriken.apply(swap_top);
 
   array<Cell, 12> cells = {G, H, I, D, E, F, A, B, C, J, K, L};
-  EXPECT_EQ(swapped.cells, cells);
+  EXPECT_EQ(swapped.cells(), cells);
 }
 
 TEST(Shuriken, SwapBottom) {
@@ -41,7 +41,7 @@ TEST(Shuriken, SwapBottom) {
   auto swapped = shuriken.apply(swap_bottom);
 
   array<Cell, 12> cells = {A, B, C, J, K, L, G, H, I, D, E, F};
-  EXPECT_EQ(swapped.cells, cells);
+  EXPECT_EQ(swapped.cells(), cells);
 }
 
 TEST(Shuriken, TurnSideA) {
@@ -49,7 +49,7 @@ TEST(Shuriken, TurnSideA) {
   auto swapped = shuriken.apply(turn_a);
 
   array<Cell, 12> cells = {F, A, B, C, D, E, G, H, I, J, K, L};
-  EXPECT_EQ(swapped.cells, cells);
+  EXPECT_EQ(swapped.cells(), cells);
 }
 
 TEST(Shuriken, TurnSideB) {
@@ -57,7 +57,7 @@ TEST(Shuriken, TurnSideB) {
   auto swapped = shuriken.apply(turn_b);
 
   array<Cell, 12> cells = {A, B, C, D, E, F, L, G, H, I, J, K};
-  EXPECT_EQ(swapped.cells, cells);
+  EXPECT_EQ(swapped.cells(), cells);
 }
 
 TEST(Shuriken, ReverseSideA) {
@@ -65,7 +65,7 @@ TEST(Shuriken, ReverseSideA) {
   auto swapped = shuriken.apply(reverse_a);
 
   array<Cell, 12> cells = {B, C, D, E, F, A, G, H, I, J, K, L};
-  EXPECT_EQ(swapped.cells, cells);
+  EXPECT_EQ(swapped.cells(), cells);
 }
 
 TEST(Shuriken, ReverseSideB) {
@@ -73,7 +73,7 @@ TEST(Shuriken, ReverseSideB) {
   auto swapped = shuriken.apply(reverse_b);
 
   array<Cell, 12> cells = {A, B, C, D, E, F, H, I, J, K, L, G};
-  EXPECT_EQ(swapped.cells, cells);
+  EXPECT_EQ(swapped.cells(), cells);
 }
 
 TEST(Shuriken, PerfectlySolvedShurikenShouldBeSolved) {
@@ -111,3 +111,50 @@ TEST(Shuriken, EqualsAndHashDontConsiderBothSidesDifferent) {
 
   EXPECT_EQ(hash1, hash2);
 }
+
+TEST(Shuriken, EqualsTellsDifferentShurikensApart) {
+  auto shuriken1 = Shuriken({A, B, C, D, E, F, G, H, I, J, K, L});
+  auto shuriken2 = Shuriken({A, B, C, D, E, F, G, H, I, J, L, K});
+
+  EXPECT_NE(shuriken1, shuriken2);
+  EXPECT_NE(std::hash<Shuriken>()(shuriken1), std::hash<Shuriken>()(shuriken2));
+}
+
+TEST(Shuriken, MovesUndoEachOther) {
+  auto shuriken = Shuriken({B, A, C, J, G, F, H, D, K, E, I, L});
+
+  EXPECT_EQ(shuriken.apply(turn_a).apply(reverse_a).cells(), shuriken.cells());
+  EXPECT_EQ(shuriken.apply(turn_b).apply(reverse_b).cells(), shuriken.cells());
+  EXPECT_EQ(shuriken.apply(swap_top).apply(swap_top).cells(), shuriken.cells());
+  EXPECT_EQ(shuriken.apply(swap_bottom).apply(swap_bottom).cells(), shuriken.cells());
+
+  auto turned = shuriken;
+  for (auto i = 0; i < 6; ++i) {
+    turned = turned.apply(turn_b);
+  }
+  EXPECT_EQ(turned.cells(), shuriken.cells());
+}
+
+TEST(Shuriken, Rank) {
+  auto solved = Shuriken({A, B, C, D, E, F, G, H, I, J, K, L});
+  EXPECT_EQ(solved.rank(), 0);
+  EXPECT_EQ(Shuriken({G, H, I, J, K, L, A, B, C, D, E, F}).rank(), 0);
+  EXPECT_EQ(Shuriken({A, B, C, D, E, F, G, H, I, J, L, K}).rank(), 1);
+
+  // A as far along side A as it goes, and everything else backwards
+  EXPECT_EQ(Shuriken({L, K, J, I, H, A, G, F, E, D, C, B}).rank(), Shuriken::count - 1);
+  EXPECT_EQ(Shuriken({G, F, E, D, C, B, L, K, J, I, H, A}).rank(), Shuriken::count - 1);
+}
+
+TEST(Shuriken, UnrankUndoesRank) {
+  for (uint32_t rank = 0; rank < Shuriken::count; rank += 9973) {
+    auto shuriken = Shuriken::unrank(rank);
+    ASSERT_EQ(shuriken.rank(), rank);
+  }
+
+  auto shuriken = Shuriken({B, A, C, J, G, F, H, D, K, E, I, L});
+  for (auto move : allMoves) {
+    auto moved = shuriken.apply(move);
+    EXPECT_EQ(Shuriken::unrank(moved.rank()), moved);
+  }
+}